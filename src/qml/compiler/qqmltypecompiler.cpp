@@ -144,6 +144,13 @@ QV4::CompiledData::CompilationUnit *QQmlTypeCompiler::compile()
             sss.scan();
         }
 
+        {
+            // Needs the AST of the binding expressions, so it can only run before code
+            // generation and not on units loaded from a cache.
+            QQmlPropertyToPropertyBindingAnnotator annotator(this);
+            annotator.annotateBindingsToIdObjectProperties();
+        }
+
         document->jsModule.fileName = typeData->urlString();
         document->jsModule.finalUrl = typeData->finalUrlString();
         QmlIR::JSCodeGen v4CodeGenerator(document->code, &document->jsGenerator, &document->jsModule, &document->jsParserEngine,
@@ -1296,6 +1303,172 @@ bool QQmlDeferredAndCustomParserBindingScanner::scanObject(int objectIndex)
     return true;
 }
 
+QQmlPropertyToPropertyBindingAnnotator::QQmlPropertyToPropertyBindingAnnotator(QQmlTypeCompiler *typeCompiler)
+    : QQmlCompilePass(typeCompiler)
+    , resolvedTypes(typeCompiler->resolvedTypes)
+    , customParsers(typeCompiler->customParserCache())
+    , qmlObjects(*typeCompiler->qmlObjects())
+    , propertyCaches(typeCompiler->propertyCaches())
+{
+}
+
+void QQmlPropertyToPropertyBindingAnnotator::annotateBindingsToIdObjectProperties()
+{
+    const QVector<quint32> &componentRoots = compiler->componentRoots();
+    for (int i = 0; i < componentRoots.count(); ++i)
+        annotateComponent(componentRoots.at(i));
+
+    annotateComponent(/*root object*/0);
+}
+
+void QQmlPropertyToPropertyBindingAnnotator::annotateComponent(int componentRoot)
+{
+    const QmlIR::Object *obj = qmlObjects.at(componentRoot);
+    int contextObject = componentRoot;
+    if (obj->flags & QV4::CompiledData::Object::IsComponent) {
+        Q_ASSERT(obj->bindingCount() == 1);
+        const QV4::CompiledData::Binding *componentBinding = obj->firstBinding();
+        Q_ASSERT(componentBinding->type == QV4::CompiledData::Binding::Type_Object);
+        contextObject = componentBinding->value.objectIndex;
+    }
+
+    if (obj->namedObjectsInComponent.count == 0)
+        return;
+
+    QHash<QString, int> idToObjectIndex;
+    idToObjectIndex.reserve(obj->namedObjectsInComponent.count);
+    for (int i = 0; i < obj->namedObjectsInComponent.count; ++i) {
+        const int objectIndex = obj->namedObjectsInComponent.at(i);
+        const QmlIR::Object *namedObject = qmlObjects.at(objectIndex);
+        if (namedObject->flags & QV4::CompiledData::Object::IsComponent)
+            continue;
+        // The JS engine looks up properties of fully dynamic types by name at run-time.
+        auto *tref = resolvedTypes.value(namedObject->inheritedTypeNameIndex);
+        if (tref && tref->isFullyDynamicType)
+            continue;
+        idToObjectIndex.insert(stringAt(namedObject->idNameIndex), objectIndex);
+    }
+
+    annotateObjectsRecursively(contextObject, idToObjectIndex);
+}
+
+/*!
+    \internal
+
+    Marks script bindings of the form \c{someId.someProperty} where \c someId refers to an
+    object of the same component. The object creator installs those as
+    QQmlPropertyToPropertyBinding, which copies the value through the static metacall and
+    subscribes to the notify signal directly, instead of running the binding through the
+    JavaScript engine. The compiled function is kept as is, so that tools and the value
+    type case can still fall back to it.
+*/
+void QQmlPropertyToPropertyBindingAnnotator::annotateObjectsRecursively(int objectIndex, const QHash<QString, int> &idToObjectIndex)
+{
+    QmlIR::Object *obj = qmlObjects.at(objectIndex);
+    if (obj->flags & QV4::CompiledData::Object::IsComponent)
+        return;
+
+    QQmlPropertyCache *propertyCache = propertyCaches->at(objectIndex);
+    const bool canAnnotate = propertyCache && !customParsers.contains(obj->inheritedTypeNameIndex);
+
+    QmlIR::PropertyResolver resolver(propertyCache);
+    QQmlPropertyData *defaultProperty = nullptr;
+    if (canAnnotate)
+        defaultProperty = obj->indexOfDefaultPropertyOrAlias != -1 ? propertyCache->parent()->defaultProperty() : propertyCache->defaultProperty();
+
+    for (QmlIR::Binding *binding = obj->firstBinding(); binding; binding = binding->next) {
+        if (binding->type >= QV4::CompiledData::Binding::Type_Object) {
+            annotateObjectsRecursively(binding->value.objectIndex, idToObjectIndex);
+            continue;
+        }
+
+        if (!canAnnotate
+            || binding->type != QV4::CompiledData::Binding::Type_Script
+            || !binding->isValueBindingNoAlias()
+            || binding->flags & QV4::CompiledData::Binding::IsCustomParserBinding
+            || binding->flags & QV4::CompiledData::Binding::IsFunctionExpression) {
+            continue;
+        }
+
+        const QmlIR::CompiledFunctionOrExpression *foe = obj->functionsAndExpressions->slowAt(binding->value.compiledScriptIndex);
+        if (!foe || foe->disableAcceleratedLookups)
+            continue;
+
+        QQmlJS::AST::ExpressionStatement *statement = QQmlJS::AST::cast<QQmlJS::AST::ExpressionStatement *>(foe->node);
+        if (!statement)
+            continue;
+        QQmlJS::AST::FieldMemberExpression *member = QQmlJS::AST::cast<QQmlJS::AST::FieldMemberExpression *>(statement->expression);
+        if (!member)
+            continue;
+        QQmlJS::AST::IdentifierExpression *base = QQmlJS::AST::cast<QQmlJS::AST::IdentifierExpression *>(member->base);
+        if (!base)
+            continue;
+
+        const int sourceObjectIndex = idToObjectIndex.value(base->name.toString(), -1);
+        if (sourceObjectIndex == -1)
+            continue;
+
+        const QString memberName = member->name.toString();
+        if (memberName == QLatin1String("destroy") || memberName == QLatin1String("toString"))
+            continue;
+
+        QQmlPropertyCache *sourceCache = propertyCaches->at(sourceObjectIndex);
+        if (!sourceCache)
+            continue;
+
+        // Mirror QObjectWrapper::getQmlProperty(): the first match by name wins, even if
+        // it is a method.
+        QQmlPropertyData *sourceProperty = sourceCache->property(memberName, nullptr, nullptr);
+        if (!sourceProperty || sourceProperty->isFunction() || !sourceCache->isAllowedInRevision(sourceProperty))
+            continue;
+
+        bool notInRevision = false;
+        const QQmlPropertyData *targetProperty = binding->propertyNameIndex != quint32(0) ? resolver.property(stringAt(binding->propertyNameIndex), &notInRevision) : defaultProperty;
+        if (!targetProperty || !canCopyPropertyValue(sourceProperty, targetProperty))
+            continue;
+
+        const QmlIR::Object *sourceObject = qmlObjects.at(sourceObjectIndex);
+        if (sourceObject->id < 0 || sourceObject->id > std::numeric_limits<quint16>::max()
+            || sourceProperty->coreIndex() > std::numeric_limits<quint16>::max()) {
+            continue;
+        }
+
+        binding->flags |= QV4::CompiledData::Binding::IsPropertyToPropertyBinding;
+        binding->propertyToProperty.sourceObjectId = quint16(sourceObject->id);
+        binding->propertyToProperty.sourcePropertyIndex = quint16(sourceProperty->coreIndex());
+        // Script bindings only use the string index for script strings, which are never
+        // annotated, so it is free to hold the property name for error messages.
+        binding->stringIndex = compiler->registerString(memberName);
+    }
+}
+
+bool QQmlPropertyToPropertyBindingAnnotator::canCopyPropertyValue(const QQmlPropertyData *source, const QQmlPropertyData *target) const
+{
+    if (!source->isFullyResolved() || !target->isFullyResolved())
+        return false;
+    if (source->isAlias() || target->isAlias() || target->isFunction())
+        return false;
+    if (source->isVarProperty() || target->isVarProperty())
+        return false;
+    // Reading a property without NOTIFY signal from JS produces a warning on every evaluation.
+    if (!source->isConstant() && source->notifyIndex() == -1)
+        return false;
+    if (source->propType() != target->propType())
+        return false;
+
+    switch (source->propType()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Double:
+    case QMetaType::Float:
+    case QMetaType::QString:
+        return !source->isEnum() && !target->isEnum();
+    default:
+        return false;
+    }
+}
+
 QQmlJSCodeGenerator::QQmlJSCodeGenerator(QQmlTypeCompiler *typeCompiler, QmlIR::JSCodeGen *v4CodeGen)
     : QQmlCompilePass(typeCompiler)
     , resolvedTypes(typeCompiler->resolvedTypes)
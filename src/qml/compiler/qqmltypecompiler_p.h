@@ -298,6 +298,24 @@ private:
     bool _seenObjectWithId;
 };
 
+class QQmlPropertyToPropertyBindingAnnotator : public QQmlCompilePass
+{
+public:
+    QQmlPropertyToPropertyBindingAnnotator(QQmlTypeCompiler *typeCompiler);
+
+    void annotateBindingsToIdObjectProperties();
+
+private:
+    void annotateComponent(int componentRoot);
+    void annotateObjectsRecursively(int objectIndex, const QHash<QString, int> &idToObjectIndex);
+    bool canCopyPropertyValue(const QQmlPropertyData *source, const QQmlPropertyData *target) const;
+
+    const QV4::CompiledData::ResolvedTypeReferenceMap &resolvedTypes;
+    const QHash<int, QQmlCustomParser*> &customParsers;
+    const QVector<QmlIR::Object*> &qmlObjects;
+    const QQmlPropertyCacheVector * const propertyCaches;
+};
+
 // ### merge with QtQml::JSCodeGen and operate directly on object->functionsAndExpressions once old compiler is gone.
 class QQmlJSCodeGenerator : public QQmlCompilePass
 {
@@ -314,6 +314,30 @@ void CompilationUnit::finalizeCompositeType(QQmlEnginePrivate *qmlEngine)
     totalBindingsCount = bindingCount;
     totalParserStatusCount = parserStatusCount;
     totalObjectCount = objectCount;
+
+    // Resolve url literals once, instead of for every instance that is created.
+    for (quint32 i = 0; i < data->nObjects && i < quint32(bindingPropertyDataPerObject.count()); ++i) {
+        const QV4::CompiledData::Object *obj = data->objectAt(i);
+        const BindingPropertyData &propertyData = bindingPropertyDataPerObject.at(i);
+        const QV4::CompiledData::Binding *binding = obj->bindingTable();
+        for (quint32 j = 0; j < obj->nBindings && j < quint32(propertyData.count()); ++j, ++binding) {
+            const QQmlPropertyData *property = propertyData.at(j);
+            if (!property || property->isFunction() || property->isEnum()
+                || property->propType() != QMetaType::QUrl
+                || binding->type != QV4::CompiledData::Binding::Type_String
+                || resolvedUrlLiterals.contains(binding->stringIndex))
+                continue;
+            resolvedUrlLiterals.insert(binding->stringIndex, resolveUrlLiteral(binding));
+        }
+    }
+}
+
+QUrl CompilationUnit::resolveUrlLiteral(const Binding *binding) const
+{
+    QString string = binding->valueAsString(data);
+    // Encoded dir-separators defeat QUrl processing - decode them first
+    string.replace(QLatin1String("%2f"), QLatin1String("/"), Qt::CaseInsensitive);
+    return string.isEmpty() ? QUrl() : finalUrl().resolved(QUrl(string));
 }
 
 bool CompilationUnit::verifyChecksum(const DependentTypesHasher &dependencyHasher) const
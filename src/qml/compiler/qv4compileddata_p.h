@@ -72,7 +72,7 @@
 QT_BEGIN_NAMESPACE
 
 // Bump this whenever the compiler data structures change in an incompatible way.
-#define QV4_DATA_STRUCTURE_VERSION 0x19
+#define QV4_DATA_STRUCTURE_VERSION 0x1A
 
 class QIODevice;
 class QQmlPropertyCache;
@@ -313,7 +313,8 @@ struct Q_QML_PRIVATE_EXPORT Binding
         IsBindingToAlias = 0x40,
         IsDeferredBinding = 0x80,
         IsCustomParserBinding = 0x100,
-        IsFunctionExpression = 0x200
+        IsFunctionExpression = 0x200,
+        IsPropertyToPropertyBinding = 0x400
     };
 
     union {
@@ -327,12 +328,20 @@ struct Q_QML_PRIVATE_EXPORT Binding
         quint32_le objectIndex;
         TranslationData translationData; // used when Type_Translation
     } value;
-    quint32_le stringIndex; // Set for Type_String, Type_Translation and Type_Script (the latter because of script strings)
+    quint32_le stringIndex; // Set for Type_String, Type_Translation and Type_Script (the latter because of script strings and property-to-property bindings)
 
     Location location;
     Location valueLocation;
 
-    quint32_le padding;
+    union {
+        quint32_le padding;
+        // Used when IsPropertyToPropertyBinding is set: the binding copies the value of
+        // the property with the given core index from the object with the given id.
+        struct {
+            quint16_le sourceObjectId;
+            quint16_le sourcePropertyIndex;
+        } propertyToProperty;
+    };
 
     bool isValueBinding() const
     {
@@ -382,6 +391,7 @@ struct Q_QML_PRIVATE_EXPORT Binding
     }
 
     bool isFunctionExpression() const { return (flags & IsFunctionExpression); }
+    bool isPropertyToPropertyBinding() const { return (flags & IsPropertyToPropertyBinding); }
 
     static QString escapedString(const QString &string);
 
@@ -966,6 +976,13 @@ public:
 
     void finalizeCompositeType(QQmlEnginePrivate *qmlEngine);
 
+    // Literal url bindings resolved against finalUrl(), keyed by the string index of the
+    // literal. This is populated once by finalizeCompositeType() when the type is loaded,
+    // so that creating instances does not have to parse and resolve the same URLs over
+    // and over again.
+    QHash<quint32, QUrl> resolvedUrlLiterals;
+    QUrl resolveUrlLiteral(const Binding *binding) const;
+
     int totalBindingsCount = 0; // Number of bindings used in this type
     int totalParserStatusCount = 0; // Number of instantiated types that are QQmlParserStatus subclasses
     int totalObjectCount = 0; // Number of objects explicitly instantiated
@@ -68,6 +68,12 @@ struct Identifier
 {
     QString string;
     uint hashValue;
+
+    // Remembers the result of the last QQmlPropertyCache lookup done with this
+    // identifier, see QQmlPropertyCache::property(const QV4::String *, ...).
+    mutable quint32 propertyCacheSerial = 0;
+    mutable void *propertyCacheNode = nullptr;
+    mutable void *propertyCacheContainer = nullptr;
 };
 
 
@@ -436,6 +436,7 @@ public:
         inline const T &operator*() const;
 
         inline Node *node() const;
+        const QStringHashData::IteratorData &iteratorData() const { return d; }
     private:
         QStringHashData::IteratorData d;
     };
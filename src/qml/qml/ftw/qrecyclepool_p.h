@@ -106,6 +106,8 @@ public:
     inline T *New(const T1 &);
     template<typename T1>
     inline T *New(T1 &);
+    template<typename T1, typename T2, typename T3, typename T4>
+    inline T *New(const T1 &, const T2 &, const T3 &, const T4 &);
 
     static inline void Delete(T *);
 
@@ -152,6 +154,15 @@ T *QRecyclePool<T, Step>::New(T1 &a)
     return rv;
 }
 
+template<typename T, int Step>
+template<typename T1, typename T2, typename T3, typename T4>
+T *QRecyclePool<T, Step>::New(const T1 &a, const T2 &b, const T3 &c, const T4 &d4)
+{
+    T *rv = d->allocate();
+    new (rv) T(a, b, c, d4);
+    return rv;
+}
+
 template<typename T, int Step>
 void QRecyclePool<T, Step>::Delete(T *t)
 {
@@ -389,6 +389,150 @@ QQmlBinding *QQmlBinding::createTranslationBinding(QV4::CompiledData::Compilatio
     return b;
 }
 
+// QQmlPropertyToPropertyBinding implements bindings of the form "someId.someProperty" that the
+// type compiler recognized (see QQmlPropertyToPropertyBindingAnnotator). Source and target
+// property have the same type, so the value is copied through the static metacall without
+// entering the JavaScript engine. The dependencies are the same ones the compiled function
+// would capture: the id object itself and the notify signal of the source property.
+class QQmlPropertyToPropertyBinding : public QQmlBinding
+{
+public:
+    QQmlPropertyToPropertyBinding(QV4::CompiledData::CompilationUnit *compilationUnit, const QV4::CompiledData::Binding *binding)
+        : m_binding(binding)
+    {
+        setCompilationUnit(compilationUnit);
+    }
+
+    QQmlSourceLocation sourceLocation() const override final
+    {
+        return QQmlSourceLocation(m_compilationUnit->fileName(), m_binding->valueLocation.line, m_binding->valueLocation.column);
+    }
+
+    QString expressionIdentifier() const override final
+    {
+        return m_compilationUnit->fileName() + QString::asprintf(":%u:%u", uint(m_binding->valueLocation.line),
+                                                                 uint(m_binding->valueLocation.column));
+    }
+
+protected:
+    void doUpdate(const DeleteWatcher &watcher,
+                  QQmlPropertyData::WriteFlags flags, QV4::Scope &) override final
+    {
+        if (watcher.wasDeleted() || !isAddedToObject())
+            return;
+
+        QQmlContextData *ctxt = context();
+        QQmlEnginePrivate *ep = QQmlEnginePrivate::get(ctxt->engine);
+        const int sourceObjectId = m_binding->propertyToProperty.sourceObjectId;
+        const int sourcePropertyIndex = m_binding->propertyToProperty.sourcePropertyIndex;
+        Q_ASSERT(sourceObjectId < ctxt->idValueCount);
+
+        DeleteWatcher captureWatcher(this);
+        QQmlPropertyCapture capture(ctxt->engine, this, &captureWatcher);
+        if (notifyOnValueChanged())
+            capture.guards.copyAndClearPrepend(activeGuards);
+
+        bool error = false;
+        QObject *source = ctxt->idValues[sourceObjectId].data();
+        QQmlData *sourceData = source ? QQmlData::get(source) : nullptr;
+        QQmlPropertyData *sourceProperty = (sourceData && sourceData->propertyCache)
+                ? sourceData->propertyCache->property(sourcePropertyIndex) : nullptr;
+
+        if (!sourceProperty || QQmlData::wasDeleted(source)) {
+            // The type compiler stores the name of the source property for this message.
+            delayedError()->setErrorDescription(QLatin1String("TypeError: Cannot read property '")
+                                                + m_compilationUnit->stringAt(m_binding->stringIndex)
+                                                + QLatin1String("' of null"));
+            error = true;
+        } else {
+            QQmlData::flushPendingBinding(source, QQmlPropertyIndex(sourcePropertyIndex));
+
+            if (notifyOnValueChanged() && !sourceProperty->isConstant() && !captureWatcher.wasDeleted())
+                capture.captureProperty(source, sourcePropertyIndex, sourceProperty->notifyIndex());
+
+            if (!captureWatcher.wasDeleted()) {
+                QQmlPropertyData *targetProperty;
+                getPropertyData(&targetProperty, nullptr);
+                Q_ASSERT(targetProperty);
+                Q_ASSERT(targetProperty->propType() == sourceProperty->propType());
+
+                switch (sourceProperty->propType()) {
+                case QMetaType::Bool:
+                    copyValue<bool>(source, sourceProperty, targetProperty, flags);
+                    break;
+                case QMetaType::Int:
+                    copyValue<int>(source, sourceProperty, targetProperty, flags);
+                    break;
+                case QMetaType::UInt:
+                    copyValue<uint>(source, sourceProperty, targetProperty, flags);
+                    break;
+                case QMetaType::Double:
+                    copyValue<double>(source, sourceProperty, targetProperty, flags);
+                    break;
+                case QMetaType::Float:
+                    copyValue<float>(source, sourceProperty, targetProperty, flags);
+                    break;
+                case QMetaType::QString:
+                    copyValue<QString>(source, sourceProperty, targetProperty, flags);
+                    break;
+                default:
+                    Q_UNREACHABLE();
+                    break;
+                }
+            }
+        }
+
+        if (!captureWatcher.wasDeleted()) {
+            // Register the id object dependency last, so that capturing it doesn't discard
+            // the guards we are reusing from the previous evaluation.
+            if (notifyOnValueChanged() && !m_permanentDependenciesRegistered) {
+                m_permanentDependenciesRegistered = true;
+                capture.captureProperty(&ctxt->idValues[sourceObjectId].bindings, QQmlPropertyCapture::Permanently);
+            }
+        }
+
+        while (QQmlJavaScriptExpressionGuard *g = capture.guards.takeFirst())
+            g->Delete();
+
+        if (captureWatcher.wasDeleted())
+            return;
+
+        if (error) {
+            delayedError()->setErrorLocation(sourceLocation());
+            delayedError()->setErrorObject(m_target.data());
+            if (!delayedError()->addError(ep))
+                ep->warning(this->error(ctxt->engine));
+        } else if (hasError()) {
+            clearError();
+        }
+    }
+
+private:
+    template <typename T>
+    Q_ALWAYS_INLINE void copyValue(QObject *source, const QQmlPropertyData *sourceProperty,
+                                   const QQmlPropertyData *targetProperty,
+                                   QQmlPropertyData::WriteFlags flags) const
+    {
+        T value;
+        sourceProperty->readProperty(source, &value);
+        targetProperty->writeProperty(targetObject(), &value, flags);
+    }
+
+    const QV4::CompiledData::Binding *m_binding;
+};
+
+QQmlBinding *QQmlBinding::createPropertyToPropertyBinding(QV4::CompiledData::CompilationUnit *unit, const QV4::CompiledData::Binding *binding, QObject *obj, QQmlContextData *ctxt)
+{
+    Q_ASSERT(binding->isPropertyToPropertyBinding());
+    QQmlPropertyToPropertyBinding *b = new QQmlPropertyToPropertyBinding(unit, binding);
+
+    b->setNotifyOnValueChanged(true);
+    b->QQmlJavaScriptExpression::setContext(ctxt);
+    b->setScopeObject(obj);
+
+    return b;
+}
+
 Q_NEVER_INLINE bool QQmlBinding::slowWrite(const QQmlPropertyData &core,
                                            const QQmlPropertyData &valueTypeData,
                                            const QV4::Value &result,
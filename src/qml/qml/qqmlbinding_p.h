@@ -81,6 +81,8 @@ public:
                                QObject *obj, QQmlContextData *ctxt, QV4::ExecutionContext *scope);
     static QQmlBinding *createTranslationBinding(QV4::CompiledData::CompilationUnit *unit, const QV4::CompiledData::Binding *binding,
                                                  QObject *obj, QQmlContextData *ctxt);
+    static QQmlBinding *createPropertyToPropertyBinding(QV4::CompiledData::CompilationUnit *unit, const QV4::CompiledData::Binding *binding,
+                                                        QObject *obj, QQmlContextData *ctxt);
     ~QQmlBinding() override;
 
     void setTarget(const QQmlProperty &);
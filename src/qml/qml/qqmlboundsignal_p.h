@@ -108,6 +108,9 @@ public:
     QQmlBoundSignal(QObject *target, int signal, QObject *owner, QQmlEngine *engine);
     ~QQmlBoundSignal();
 
+    static inline QQmlBoundSignal *New(QObject *target, int signal, QObject *owner, QQmlEngine *engine);
+    inline void Delete();
+
     void removeFromObject();
 
     QQmlBoundSignalExpression *expression() const;
@@ -131,6 +134,23 @@ private:
     QQmlBoundSignalExpressionPointer m_expression;
 };
 
+/*
+    Signal handlers are created for every on<Signal> of every instantiated object, so
+    they are taken from a per-engine pool rather than the general heap. A handler
+    created with New() must be destroyed with Delete().
+*/
+QQmlBoundSignal *QQmlBoundSignal::New(QObject *target, int signal, QObject *owner,
+                                      QQmlEngine *engine)
+{
+    Q_ASSERT(engine);
+    return QQmlEnginePrivate::get(engine)->boundSignalPool.New(target, signal, owner, engine);
+}
+
+void QQmlBoundSignal::Delete()
+{
+    QRecyclePool<QQmlBoundSignal>::Delete(this);
+}
+
 QT_END_NAMESPACE
 
 #endif // QQMLBOUNDSIGNAL_P_H
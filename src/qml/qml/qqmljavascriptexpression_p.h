@@ -176,6 +176,7 @@ private:
     friend class QQmlPropertyCapture;
     friend void QQmlJavaScriptExpressionGuard_callback(QQmlNotifierEndpoint *, void **);
     friend class QQmlTranslationBinding;
+    friend class QQmlPropertyToPropertyBinding;
 
     QQmlDelayedError *m_error;
 
@@ -964,8 +964,8 @@ void QQmlPropertyPrivate::takeSignalExpression(const QQmlProperty &that,
 
     if (expr) {
         int signalIndex = QQmlPropertyPrivate::get(that)->signalIndex();
-        QQmlBoundSignal *signal = new QQmlBoundSignal(that.d->object, signalIndex, that.d->object,
-                                                      expr->context()->engine);
+        QQmlBoundSignal *signal = QQmlBoundSignal::New(that.d->object, signalIndex, that.d->object,
+                                                       expr->context()->engine);
         signal->takeExpression(expr);
     }
 }
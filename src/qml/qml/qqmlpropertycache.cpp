@@ -48,6 +48,7 @@
 #include <private/qmetaobjectbuilder_p.h>
 
 #include <private/qv4value_p.h>
+#include <private/qv4identifier_p.h>
 
 #include <QtCore/qdebug.h>
 #include <QtCore/QCryptographicHash>
@@ -721,6 +722,7 @@ void QQmlPropertyCache::update(const QMetaObject *metaObject)
 {
     Q_ASSERT(metaObject);
     stringCache.clear();
+    invalidateLookupSerial();
 
     // Preallocate enough space in the index caches for all the properties/methods/signals that
     // are not cached in a parent cache so that the caches never need to be reallocated as this
@@ -762,6 +764,7 @@ void QQmlPropertyCache::invalidate(const QMetaObject *metaObject)
         methodIndexCacheStart = parent()->methodIndexCache.count() + parent()->methodIndexCacheStart;
         signalHandlerIndexCacheStart = parent()->signalHandlerIndexCache.count() + parent()->signalHandlerIndexCacheStart;
         stringCache.linkAndReserve(parent()->stringCache, reserve);
+        invalidateLookupSerial();
         append(metaObject, -1);
     } else {
         propertyIndexCacheStart = 0;
@@ -771,6 +774,56 @@ void QQmlPropertyCache::invalidate(const QMetaObject *metaObject)
     }
 }
 
+/*! \internal
+    Looks up \a key like the generic property() overload, but remembers the position
+    of the name in the string cache in the identifier of \a key. Property names used
+    from JavaScript are identifiers, so repeated lookups of the same name in the same
+    cache skip hashing, string comparison and the search for the containing hash of
+    linked caches.
+
+    Identifiers belong to a single engine and thread, while property caches may be
+    shared. The remembered position is therefore tagged with the lookup serial of the
+    cache, which is unique for the life time of the process and changes whenever the
+    contents of the cache change.
+*/
+QQmlPropertyData *QQmlPropertyCache::property(const QV4::String *key, QObject *object, QQmlContextData *context) const
+{
+    const QV4::Identifier *identifier = key->identifier();
+    if (!identifier)
+        return findProperty(stringCache.find(key), object, context);
+
+    const quint32 serial = lookupSerial();
+    if (identifier->propertyCacheSerial == serial) {
+        QStringHashData::IteratorData data;
+        data.n = static_cast<QStringHashNode *>(identifier->propertyCacheNode);
+        data.p = identifier->propertyCacheContainer;
+        return findProperty(StringCache::ConstIterator(data), object, context);
+    }
+
+    const StringCache::ConstIterator it = stringCache.find(key);
+    identifier->propertyCacheSerial = serial;
+    identifier->propertyCacheNode = it.iteratorData().n;
+    identifier->propertyCacheContainer = it.iteratorData().p;
+    return findProperty(it, object, context);
+}
+
+quint32 QQmlPropertyCache::lookupSerial() const
+{
+    quint32 serial = _lookupSerial.load();
+    if (Q_LIKELY(serial))
+        return serial;
+
+    static QBasicAtomicInteger<quint32> nextSerial = Q_BASIC_ATOMIC_INITIALIZER(0);
+    do {
+        serial = nextSerial.fetchAndAddRelaxed(1) + 1;
+    } while (!serial);
+
+    quint32 current;
+    if (!_lookupSerial.testAndSetRelaxed(0, serial, current))
+        serial = current;
+    return serial;
+}
+
 QQmlPropertyData *QQmlPropertyCache::findProperty(StringCache::ConstIterator it, QObject *object, QQmlContextData *context) const
 {
     QQmlData *data = (object ? QQmlData::get(object) : nullptr);
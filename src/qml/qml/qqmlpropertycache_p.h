@@ -433,6 +433,12 @@ public:
         return findProperty(stringCache.find(key), object, context);
     }
 
+    QQmlPropertyData *property(const QV4::String *key, QObject *object, QQmlContextData *context) const;
+    QQmlPropertyData *property(QV4::String *key, QObject *object, QQmlContextData *context) const
+    {
+        return property(const_cast<const QV4::String *>(key), object, context);
+    }
+
     QQmlPropertyData *property(int) const;
     QQmlPropertyData *method(int) const;
     QQmlPropertyData *signal(int index) const;
@@ -530,8 +536,12 @@ private:
     {
         stringCache.insert(key, qMakePair(index, data));
         _hasPropertyOverrides |= isOverride;
+        invalidateLookupSerial();
     }
 
+    quint32 lookupSerial() const;
+    void invalidateLookupSerial() { _lookupSerial.store(0); }
+
 private:
     QQmlPropertyCache *_parent;
     int propertyIndexCacheStart;
@@ -554,6 +564,9 @@ private:
     QQmlPropertyCacheMethodArguments *argumentsCache;
     int _jsFactoryMethodIndex;
     QByteArray _checksum;
+    // Identifies the current contents of stringCache for the lookup results that are
+    // remembered in QV4::Identifier. Assigned lazily, never reused, reset on change.
+    mutable QAtomicInteger<quint32> _lookupSerial;
 };
 
 typedef QQmlRefPointer<QQmlPropertyCache> QQmlPropertyCachePtr;
@@ -214,6 +214,7 @@ QQmlDelegateModelPrivate::QQmlDelegateModelPrivate(QQmlContext *ctxt)
     , m_transaction(false)
     , m_incubatorCleanupScheduled(false)
     , m_waitingToFetchMore(false)
+    , m_prefetchScheduled(false)
     , m_cacheItems(nullptr)
     , m_items(nullptr)
     , m_persistedItems(nullptr)
@@ -237,6 +238,30 @@ void QQmlDelegateModelPrivate::requestMoreIfNecessary()
     }
 }
 
+void QQmlDelegateModelPrivate::schedulePrefetch()
+{
+    Q_Q(QQmlDelegateModel);
+    if (!m_prefetchScheduled) {
+        m_prefetchScheduled = true;
+        QCoreApplication::postEvent(q, new QEvent(QEvent::Type(QEvent::User + 1)));
+    }
+}
+
+void QQmlDelegateModelPrivate::prefetchBatch()
+{
+    // Only a few rows are read per event, so that a slow model doesn't hold up
+    // input handling and animations for the whole range at once.
+    const int count = qMin(m_prefetchRows.count(), 16);
+    if (count <= 0)
+        return;
+
+    for (int i = 0; i < count; ++i)
+        m_adaptorModel.prefetch(m_prefetchRows.at(i), 1);
+    m_prefetchRows.remove(0, count);
+    if (!m_prefetchRows.isEmpty())
+        schedulePrefetch();
+}
+
 void QQmlDelegateModelPrivate::init()
 {
     Q_Q(QQmlDelegateModel);
@@ -264,7 +289,7 @@ QQmlDelegateModel::~QQmlDelegateModel()
 {
     Q_D(QQmlDelegateModel);
 
-    for (QQmlDelegateModelItem *cacheItem : qAsConst(d->m_cache)) {
+    for (QQmlDelegateModelItem *cacheItem : d->m_cache + d->m_reusableItemsPool) {
         if (cacheItem->object) {
             delete cacheItem->object;
 
@@ -344,6 +369,7 @@ void QQmlDelegateModel::componentComplete()
             defaultGroups | Compositor::AppendFlag | Compositor::PrependFlag,
             &inserts);
     d->itemsInserted(inserts);
+    d->applyGroupFilters();
     d->emitChanges();
     d->requestMoreIfNecessary();
 }
@@ -374,6 +400,7 @@ void QQmlDelegateModel::setModel(const QVariant &model)
 
     if (d->m_complete)
         _q_itemsRemoved(0, d->m_count);
+    d->drainReusableItemsPool(0);
 
     d->m_adaptorModel.setModel(model, this, d->m_context->engine());
     d->m_adaptorModel.replaceWatchedRoles(QList<QByteArray>(), d->m_watchedRoles);
@@ -411,6 +438,7 @@ void QQmlDelegateModel::setDelegate(QQmlComponent *delegate)
     bool wasValid = d->m_delegate != nullptr;
     d->m_delegate = delegate;
     d->m_delegateValidated = false;
+    d->drainReusableItemsPool(0);
     if (wasValid && d->m_complete) {
         for (int i = 1; i < d->m_groupCount; ++i) {
             QQmlDelegateModelGroupPrivate::get(d->m_groups[i])->changeSet.remove(
@@ -470,6 +498,7 @@ void QQmlDelegateModel::setRootIndex(const QVariant &root)
     if (changed || !d->m_adaptorModel.isValid()) {
         const int oldCount = d->m_count;
         d->m_adaptorModel.rootIndex = modelIndex;
+        d->m_adaptorModel.clearPrefetched();
         if (!d->m_adaptorModel.isValid() && d->m_adaptorModel.aim())  // The previous root index was invalidated, so we need to reconnect the model.
             d->m_adaptorModel.setModel(d->m_adaptorModel.list.list(), this, d->m_context->engine());
         if (d->m_adaptorModel.canFetchMore())
@@ -534,7 +563,7 @@ int QQmlDelegateModel::count() const
     return d->m_compositor.count(d->m_compositorGroup);
 }
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     QQmlDelegateModel::ReleaseFlags stat = nullptr;
     if (!object)
@@ -542,6 +571,18 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
 
     if (QQmlDelegateModelItem *cacheItem = QQmlDelegateModelItem::dataForObject(object)) {
         if (cacheItem->releaseObject()) {
+            if (reusableFlag == QQmlInstanceModel::Reusable && isReusable(cacheItem)) {
+                // Keep the object and its context around and hand them out again from
+                // object() instead of creating a new delegate instance.
+                const int index = cacheItem->groupIndex(m_compositorGroup);
+                removeCacheItem(cacheItem);
+                cacheItem->groups = 0;
+                cacheItem->poolTime = 0;
+                m_reusableItemsPool.append(cacheItem);
+                Q_EMIT q_func()->itemPooled(index, object);
+                return QQmlInstanceModel::Pooled;
+            }
+
             cacheItem->destroyObject();
             emitDestroyingItem(object);
             if (cacheItem->incubationTask) {
@@ -561,13 +602,72 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
   Returns ReleaseStatus flags.
 */
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     Q_D(QQmlDelegateModel);
-    QQmlInstanceModel::ReleaseFlags stat = d->release(item);
+    QQmlInstanceModel::ReleaseFlags stat = d->release(item, reusableFlag);
     return stat;
 }
 
+/*
+  Destroys the pooled delegate instances that have not been reused during the
+  last \a maxPoolTime calls. Views call this once per layout pass, so that the
+  pool only holds on to what the next pass is likely to need.
+*/
+void QQmlDelegateModel::drainReusableItemsPool(int maxPoolTime)
+{
+    Q_D(QQmlDelegateModel);
+    d->drainReusableItemsPool(maxPoolTime);
+}
+
+int QQmlDelegateModel::poolSize()
+{
+    Q_D(QQmlDelegateModel);
+    return d->m_reusableItemsPool.count();
+}
+
+/*
+  Hints that the items from \a index to \a index + \a count in the filter group are
+  likely to be requested soon. Models that can be slow to access, such as a
+  QAbstractItemModel backed by a database, then read the data of those rows in small
+  batches from the event loop, so that creating their delegates later doesn't have to
+  wait for the model. Rows that already have an item are skipped, as its delegate has
+  read their data. Data previously read for rows outside the range is discarded.
+*/
+void QQmlDelegateModel::prefetch(int index, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (!d->m_complete || !d->m_adaptorModel.canPrefetch())
+        return;
+
+    index = qMax(0, index);
+    count = qMin(count, d->m_compositor.count(d->m_compositorGroup) - index);
+    if (count <= 0)
+        return;
+
+    // Items in a group can be in a different order than in the model, so use the
+    // range of model indexes the items map to.
+    int first = d->m_count;
+    int last = -1;
+    d->m_prefetchRows.clear();
+    Compositor::iterator it = d->m_compositor.find(d->m_compositorGroup, index);
+    for (int i = 0; i < count; ++i, it += 1) {
+        if (it.list<QQmlAdaptorModel>()) {
+            const int modelIndex = it.modelIndex();
+            first = qMin(first, modelIndex);
+            last = qMax(last, modelIndex);
+            if (!it->inCache())
+                d->m_prefetchRows.append(modelIndex);
+        }
+    }
+    if (last < first)
+        return;
+
+    d->m_adaptorModel.trimPrefetched(first, last - first + 1);
+    if (!d->m_prefetchRows.isEmpty())
+        d->schedulePrefetch();
+}
+
 // Cancel a requested async item
 void QQmlDelegateModel::cancel(int index)
 {
@@ -872,6 +972,38 @@ void QQmlDelegateModelPrivate::removeCacheItem(QQmlDelegateModelItem *cacheItem)
     Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
 }
 
+bool QQmlDelegateModelPrivate::isReusable(QQmlDelegateModelItem *cacheItem) const
+{
+    // Only delegate instances nothing else holds on to can be rebound to another row.
+    // Object models proxy the model object through a separate context, so their
+    // instances cannot be moved to a different object.
+    return cacheItem->object
+            && !cacheItem->incubationTask
+            && cacheItem->scriptRef == 1
+            && !(cacheItem->groups & Compositor::UnresolvedFlag)
+            && !m_adaptorModel.hasProxyObject()
+            && !qmlobject_cast<QQuickPackage *>(cacheItem->object);
+}
+
+void QQmlDelegateModelPrivate::destroyPooledItem(QQmlDelegateModelItem *cacheItem)
+{
+    QObject *object = cacheItem->object;
+    cacheItem->destroyObject();
+    emitDestroyingItem(object);
+    cacheItem->Dispose();
+}
+
+void QQmlDelegateModelPrivate::drainReusableItemsPool(int maxPoolTime)
+{
+    for (int i = m_reusableItemsPool.count() - 1; i >= 0; --i) {
+        QQmlDelegateModelItem *cacheItem = m_reusableItemsPool.at(i);
+        if (++cacheItem->poolTime <= maxPoolTime)
+            continue;
+        m_reusableItemsPool.removeAt(i);
+        destroyPooledItem(cacheItem);
+    }
+}
+
 void QQmlDelegateModelPrivate::incubatorStatusChanged(QQDMIncubationTask *incubationTask, QQmlIncubator::Status status)
 {
     if (!isDoneIncubating(status))
@@ -946,7 +1078,11 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
     QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex) : 0;
 
     if (!cacheItem) {
-        cacheItem = m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
+        QQmlDelegateModelItem *reusedItem = nullptr;
+        if (!m_reusableItemsPool.isEmpty() && it.list<QQmlAdaptorModel>())
+            reusedItem = m_reusableItemsPool.takeLast();
+
+        cacheItem = reusedItem ? reusedItem : m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
         if (!cacheItem)
             return nullptr;
 
@@ -955,6 +1091,16 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
         m_cache.insert(it.cacheIndex, cacheItem);
         m_compositor.setFlags(it, 1, Compositor::CacheFlag);
         Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
+
+        if (reusedItem) {
+            reusedItem->reuse(m_adaptorModel, it.modelIndex());
+            if (QQmlDelegateModelAttached *attached = reusedItem->attached) {
+                for (int i = 1; i < m_groupCount; ++i)
+                    attached->m_currentIndex[i] = it.index[i];
+                attached->emitChanges();
+            }
+            Q_EMIT q_func()->itemReused(it.index[m_compositorGroup], reusedItem->object);
+        }
     }
 
     // Bump the reference counts temporarily so neither the content data or the delegate object
@@ -1126,6 +1272,97 @@ void QQmlDelegateModelPrivate::setGroups(
     emitChanges();
 }
 
+/*
+    Updates the membership of the groups that have a filterRole for the items with model
+    indexes in the range starting at \a modelIndex, or for all items if \a count is negative.
+    Consecutive items that join or leave a group are updated together. Returns true if the
+    membership of any group changed; the caller is responsible for emitting the changes.
+*/
+bool QQmlDelegateModelPrivate::applyGroupFilters(int modelIndex, int count)
+{
+    if (!m_complete)
+        return false;
+
+    bool filtered = false;
+    for (int group = Compositor::MinimumGroupCount; group < m_groupCount && !filtered; ++group)
+        filtered = QQmlDelegateModelGroupPrivate::get(m_groups[group])->isFiltered();
+    if (!filtered)
+        return false;
+
+    // Find the positions in the items group of the model items to evaluate, rather than
+    // visiting every item to compare its model index.
+    QVector<QQmlChangeSet::Change> spans;
+    if (count < 0) {
+        spans.append(QQmlChangeSet::Change(0, m_compositor.count(Compositor::Default)));
+    } else {
+        QVector<Compositor::Change> changes;
+        m_compositor.listItemsChanged(&m_adaptorModel, modelIndex, count, &changes);
+        for (const Compositor::Change &change : qAsConst(changes)) {
+            if (change.inGroup(Compositor::Default))
+                spans.append(QQmlChangeSet::Change(change.index[Compositor::Default], change.count));
+        }
+    }
+
+    struct Run {
+        int from;
+        int count;
+        int group;
+        bool include;
+    };
+    QVector<Run> runs;
+
+    for (int group = Compositor::MinimumGroupCount; group < m_groupCount; ++group) {
+        QQmlDelegateModelGroupPrivate *groupPrivate = QQmlDelegateModelGroupPrivate::get(m_groups[group]);
+        if (!groupPrivate->isFiltered())
+            continue;
+
+        for (const QQmlChangeSet::Change &span : qAsConst(spans)) {
+            if (span.count <= 0)
+                continue;
+            Compositor::iterator it = m_compositor.find(Compositor::Default, span.index);
+            for (int i = span.index; i < span.end(); ++i, it += 1) {
+                QQmlAdaptorModel *model = it.list<QQmlAdaptorModel>();
+                if (!model)
+                    continue;
+
+                const bool include = groupPrivate->filterAccepts(
+                            model->value(it.modelIndex(), groupPrivate->filterRole).toString());
+                if (include == it->inGroup(group))
+                    continue;
+
+                if (!runs.isEmpty()) {
+                    Run &last = runs.last();
+                    if (last.group == group && last.include == include && last.from + last.count == i) {
+                        ++last.count;
+                        continue;
+                    }
+                }
+                runs.append(Run { i, 1, group, include });
+            }
+        }
+    }
+
+    if (runs.isEmpty())
+        return false;
+
+    // Membership of other groups doesn't affect indexes in the items group, so the
+    // ranges found above stay valid while they are applied.
+    QVector<Compositor::Remove> removes;
+    for (const Run &run : qAsConst(runs)) {
+        if (!run.include)
+            m_compositor.clearFlags(Compositor::Default, run.from, run.count, 1 << run.group, &removes);
+    }
+    itemsRemoved(removes);
+
+    QVector<Compositor::Insert> inserts;
+    for (const Run &run : qAsConst(runs)) {
+        if (run.include)
+            m_compositor.setFlags(Compositor::Default, run.from, run.count, 1 << run.group, &inserts);
+    }
+    itemsInserted(inserts);
+    return true;
+}
+
 bool QQmlDelegateModel::event(QEvent *e)
 {
     Q_D(QQmlDelegateModel);
@@ -1136,6 +1373,9 @@ bool QQmlDelegateModel::event(QEvent *e)
         d->m_incubatorCleanupScheduled = false;
         qDeleteAll(d->m_finishedIncubating);
         d->m_finishedIncubating.clear();
+    } else if (e->type() == QEvent::User + 1) {
+        d->m_prefetchScheduled = false;
+        d->prefetchBatch();
     }
     return QQmlInstanceModel::event(e);
 }
@@ -1165,12 +1405,15 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
     if (count <= 0 || !d->m_complete)
         return;
 
-    if (d->m_adaptorModel.notify(d->m_cache, index, count, roles)) {
+    const bool notified = d->m_adaptorModel.notify(d->m_cache, index, count, roles);
+    if (notified) {
         QVector<Compositor::Change> changes;
         d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
         d->itemsChanged(changes);
-        d->emitChanges();
     }
+    const bool filtered = d->applyGroupFilters(index, count);
+    if (notified || filtered)
+        d->emitChanges();
 }
 
 static void incrementIndexes(QQmlDelegateModelItem *cacheItem, int count, const int *deltas)
@@ -1262,6 +1505,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
         return;
 
     d->m_count += count;
+    d->m_adaptorModel.clearPrefetched();
 
     const QList<QQmlDelegateModelItem *> cache = d->m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
@@ -1273,6 +1517,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsInserted(inserts);
+    d->applyGroupFilters(index, count);
     d->emitChanges();
 }
 
@@ -1400,6 +1645,7 @@ void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
         return;
 
     d->m_count -= count;
+    d->m_adaptorModel.clearPrefetched();
     const QList<QQmlDelegateModelItem *> cache = d->m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
         QQmlDelegateModelItem *item = cache.at(i);
@@ -1453,6 +1699,8 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
     const int maximum = qMax(from, to) + count;
     const int difference = from > to ? count : -count;
 
+    d->m_adaptorModel.clearPrefetched();
+
     const QList<QQmlDelegateModelItem *> cache = d->m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
         QQmlDelegateModelItem *item = cache.at(i);
@@ -1508,6 +1756,8 @@ void QQmlDelegateModel::_q_modelReset()
 
     int oldCount = d->m_count;
     d->m_adaptorModel.rootIndex = QModelIndex();
+    d->m_adaptorModel.clearPrefetched();
+    d->drainReusableItemsPool(0);
 
     if (d->m_complete) {
         d->m_count = d->m_adaptorModel.count();
@@ -1526,6 +1776,7 @@ void QQmlDelegateModel::_q_modelReset()
         if (d->m_count)
             d->m_compositor.listItemsInserted(&d->m_adaptorModel, 0, d->m_count, &inserts);
         d->itemsMoved(removes, inserts);
+        d->applyGroupFilters();
         d->m_reset = true;
 
         if (d->m_adaptorModel.canFetchMore())
@@ -1918,6 +2169,8 @@ QQmlDelegateModelItem::QQmlDelegateModelItem(
     , scriptRef(0)
     , groups(0)
     , index(modelIndex)
+    , column(0)
+    , poolTime(0)
 {
     metaType->addref();
 }
@@ -2259,6 +2512,27 @@ void QQmlDelegateModelGroupPrivate::emitChanges(QV4::ExecutionEngine *v4)
         emit q->countChanged();
 }
 
+void QQmlDelegateModelGroupPrivate::updateFilter()
+{
+    if (!model)
+        return;
+    QQmlDelegateModelPrivate *modelPrivate = QQmlDelegateModelPrivate::get(model);
+    if (modelPrivate->applyGroupFilters())
+        modelPrivate->emitChanges();
+}
+
+void QQmlDelegateModelGroupPrivate::clearFilter()
+{
+    if (!model)
+        return;
+    QQmlDelegateModelPrivate *modelPrivate = QQmlDelegateModelPrivate::get(model);
+    const int count = modelPrivate->m_compositor.count(Compositor::Default);
+    if (!modelPrivate->m_complete || count == 0)
+        return;
+    modelPrivate->addGroups(
+            modelPrivate->m_compositor.find(Compositor::Default, 0), count, Compositor::Default, 1 << group);
+}
+
 void QQmlDelegateModelGroupPrivate::emitModelUpdated(bool reset)
 {
     for (QQmlDelegateModelGroupEmitterList::iterator it = emitters.begin(); it != emitters.end(); ++it)
@@ -2425,6 +2699,129 @@ void QQmlDelegateModelGroup::setDefaultInclude(bool include)
     }
 }
 
+/*!
+    \qmlproperty string QtQml.Models::DelegateModelGroup::filterRole
+    \since 5.12
+
+    This property holds the name of the model role used to filter the group.
+
+    When it is set, the group contains exactly those items of the
+    \l {QtQml.Models::DelegateModel::items}{items} group whose value for the role
+    matches \l filterString. Membership is kept up to date as items are inserted into
+    or changed in the model, without any delegates being created, which is considerably
+    faster than filtering with setGroups() from JavaScript:
+
+    \code
+    DelegateModel {
+        id: visualModel
+        model: contactModel
+        groups: DelegateModelGroup {
+            id: matches
+            name: "matches"
+            filterRole: "name"
+            filterString: searchField.text
+            filterCaseSensitivity: Qt.CaseInsensitive
+        }
+        filterOnGroup: "matches"
+        delegate: Text { text: name }
+    }
+    \endcode
+
+    While a filter is set, changes made to the membership of the group through
+    its functions or an item's \c groups property are overridden whenever the
+    filter is evaluated again for that item.
+
+    Clearing the filter role adds every item of the items group back to the group,
+    as if it were matched by an empty \l filterString. From then on the membership of
+    the group is only changed through its functions and the items' \c groups property.
+
+    The items and persistedItems groups cannot be filtered.
+
+    By default, this property is empty and the group is not filtered.
+*/
+
+QString QQmlDelegateModelGroup::filterRole() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filterRole;
+}
+
+void QQmlDelegateModelGroup::setFilterRole(const QString &role)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->filterRole == role)
+        return;
+    if (d->model && d->group < Compositor::MinimumGroupCount) {
+        qmlWarning(this) << tr("The %1 group cannot be filtered").arg(d->name);
+        return;
+    }
+
+    d->filterRole = role;
+    if (d->isFiltered())
+        d->updateFilter();
+    else
+        d->clearFilter();
+    emit filterRoleChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModelGroup::filterString
+    \since 5.12
+
+    This property holds the string an item's \l filterRole value must contain for
+    the item to be in the group. An empty string matches every item.
+
+    \sa filterCaseSensitivity
+*/
+
+QString QQmlDelegateModelGroup::filterString() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filterString;
+}
+
+void QQmlDelegateModelGroup::setFilterString(const QString &string)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->filterString == string)
+        return;
+
+    d->filterString = string;
+    if (d->isFiltered())
+        d->updateFilter();
+    emit filterStringChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::DelegateModelGroup::filterCaseSensitivity
+    \since 5.12
+
+    This property holds whether \l filterString is matched case sensitively.
+
+    \list
+    \li Qt.CaseSensitive (default)
+    \li Qt.CaseInsensitive
+    \endlist
+*/
+
+Qt::CaseSensitivity QQmlDelegateModelGroup::filterCaseSensitivity() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filterCaseSensitivity;
+}
+
+void QQmlDelegateModelGroup::setFilterCaseSensitivity(Qt::CaseSensitivity sensitivity)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->filterCaseSensitivity == sensitivity)
+        return;
+
+    d->filterCaseSensitivity = sensitivity;
+    if (d->isFiltered())
+        d->updateFilter();
+    emit filterCaseSensitivityChanged();
+}
+
 /*!
     \qmlmethod object QtQml.Models::DelegateModelGroup::get(int index)
 
@@ -3157,7 +3554,7 @@ QObject *QQmlPartsModel::object(int index, QQmlIncubator::IncubationMode incubat
     return nullptr;
 }
 
-QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item)
+QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item, ReusableFlag)
 {
     QQmlInstanceModel::ReleaseFlags flags = nullptr;
 
@@ -113,7 +113,7 @@ public:
     int count() const override;
     bool isValid() const override { return delegate() != nullptr; }
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *object) override;
+    ReleaseFlags release(QObject *object, ReusableFlag reusableFlag = NotReusable) override;
     void cancel(int index) override;
     QString stringValue(int index, const QString &role) override;
     void setWatchedRoles(const QList<QByteArray> &roles) override;
@@ -121,6 +121,10 @@ public:
 
     int indexOf(QObject *object, QObject *objectContext) const override;
 
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override;
+    void prefetch(int index, int count) override;
+
     QString filterGroup() const;
     void setFilterGroup(const QString &group);
     void resetFilterGroup();
@@ -165,6 +169,9 @@ class Q_QML_PRIVATE_EXPORT QQmlDelegateModelGroup : public QObject
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
     Q_PROPERTY(bool includeByDefault READ defaultInclude WRITE setDefaultInclude NOTIFY defaultIncludeChanged)
+    Q_PROPERTY(QString filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged REVISION 12)
+    Q_PROPERTY(QString filterString READ filterString WRITE setFilterString NOTIFY filterStringChanged REVISION 12)
+    Q_PROPERTY(Qt::CaseSensitivity filterCaseSensitivity READ filterCaseSensitivity WRITE setFilterCaseSensitivity NOTIFY filterCaseSensitivityChanged REVISION 12)
 public:
     QQmlDelegateModelGroup(QObject *parent = nullptr);
     QQmlDelegateModelGroup(const QString &name, QQmlDelegateModel *model, int compositorType, QObject *parent = nullptr);
@@ -178,6 +185,15 @@ public:
     bool defaultInclude() const;
     void setDefaultInclude(bool include);
 
+    QString filterRole() const;
+    void setFilterRole(const QString &role);
+
+    QString filterString() const;
+    void setFilterString(const QString &string);
+
+    Qt::CaseSensitivity filterCaseSensitivity() const;
+    void setFilterCaseSensitivity(Qt::CaseSensitivity sensitivity);
+
     Q_INVOKABLE QQmlV4Handle get(int index);
 
 public Q_SLOTS:
@@ -194,6 +210,9 @@ Q_SIGNALS:
     void countChanged();
     void nameChanged();
     void defaultIncludeChanged();
+    Q_REVISION(12) void filterRoleChanged();
+    Q_REVISION(12) void filterStringChanged();
+    Q_REVISION(12) void filterCaseSensitivityChanged();
     void changed(const QQmlV4Handle &removed, const QQmlV4Handle &inserted);
 private:
     Q_DECLARE_PRIVATE(QQmlDelegateModelGroup)
@@ -123,10 +123,16 @@ public:
     int modelIndex() const { return index; }
     void setModelIndex(int idx) { index = idx; Q_EMIT modelIndexChanged(); }
 
+    // Only table models address more than the first column of a QAbstractItemModel.
+    int modelColumn() const { return column; }
+    void setModelColumn(int col) { column = col; }
+
     virtual QV4::ReturnedValue get() { return QV4::QObjectWrapper::wrap(v4, this); }
 
     virtual void setValue(const QString &role, const QVariant &value) { Q_UNUSED(role); Q_UNUSED(value); }
     virtual bool resolveIndex(const QQmlAdaptorModel &, int) { return false; }
+    // Points a pooled item at another row of the model and notifies all of its data.
+    virtual void reuse(const QQmlAdaptorModel &, int idx) { setModelIndex(idx); }
 
     static QV4::ReturnedValue get_model(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
     static QV4::ReturnedValue get_groups(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
@@ -145,6 +151,8 @@ public:
     int scriptRef;
     int groups;
     int index;
+    int column;
+    int poolTime;
 
 Q_SIGNALS:
     void modelIndexChanged();
@@ -215,7 +223,8 @@ class QQmlDelegateModelGroupPrivate : public QObjectPrivate
 public:
     Q_DECLARE_PUBLIC(QQmlDelegateModelGroup)
 
-    QQmlDelegateModelGroupPrivate() : group(Compositor::Cache), defaultInclude(false) {}
+    QQmlDelegateModelGroupPrivate()
+        : group(Compositor::Cache), filterCaseSensitivity(Qt::CaseSensitive), defaultInclude(false) {}
 
     static QQmlDelegateModelGroupPrivate *get(QQmlDelegateModelGroup *group) {
         return static_cast<QQmlDelegateModelGroupPrivate *>(QObjectPrivate::get(group)); }
@@ -229,6 +238,12 @@ public:
     void initPackage(int index, QQuickPackage *package);
     void destroyingPackage(QQuickPackage *package);
 
+    bool isFiltered() const { return !filterRole.isEmpty(); }
+    bool filterAccepts(const QString &value) const {
+        return filterString.isEmpty() || value.contains(filterString, filterCaseSensitivity); }
+    void updateFilter();
+    void clearFilter();
+
     bool parseIndex(const QV4::Value &value, int *index, Compositor::Group *group) const;
     bool parseGroupArgs(
             QQmlV4Function *args, Compositor::Group *group, int *index, int *count, int *groups) const;
@@ -238,6 +253,9 @@ public:
     QQmlDelegateModelGroupEmitterList emitters;
     QQmlChangeSet changeSet;
     QString name;
+    QString filterRole;
+    QString filterString;
+    Qt::CaseSensitivity filterCaseSensitivity;
     bool defaultInclude;
 };
 
@@ -259,7 +277,7 @@ public:
 
     void requestMoreIfNecessary();
     QObject *object(Compositor::Group group, int index, QQmlIncubator::IncubationMode incubationMode);
-    QQmlDelegateModel::ReleaseFlags release(QObject *object);
+    QQmlDelegateModel::ReleaseFlags release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
     QString stringValue(Compositor::Group group, int index, const QString &name);
     void emitCreatedPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
     void emitInitPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
@@ -271,8 +289,16 @@ public:
     void emitDestroyingItem(QObject *item) { Q_EMIT q_func()->destroyingItem(item); }
     void removeCacheItem(QQmlDelegateModelItem *cacheItem);
 
+    bool isReusable(QQmlDelegateModelItem *cacheItem) const;
+    void destroyPooledItem(QQmlDelegateModelItem *cacheItem);
+    void drainReusableItemsPool(int maxPoolTime);
+    void schedulePrefetch();
+    void prefetchBatch();
+
     void updateFilterGroup();
 
+    bool applyGroupFilters(int modelIndex = 0, int count = -1);
+
     void addGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
     void removeGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
     void setGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
@@ -312,8 +338,10 @@ public:
     QQmlDelegateModelGroupEmitterList m_pendingParts;
 
     QList<QQmlDelegateModelItem *> m_cache;
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
     QList<QQDMIncubationTask *> m_finishedIncubating;
     QList<QByteArray> m_watchedRoles;
+    QVector<int> m_prefetchRows;
 
     QString m_filterGroup;
 
@@ -327,6 +355,7 @@ public:
     bool m_transaction : 1;
     bool m_incubatorCleanupScheduled : 1;
     bool m_waitingToFetchMore : 1;
+    bool m_prefetchScheduled : 1;
 
     union {
         struct {
@@ -355,7 +384,7 @@ public:
     int count() const override;
     bool isValid() const override;
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *item) override;
+    ReleaseFlags release(QObject *item, ReusableFlag reusableFlag = NotReusable) override;
     QString stringValue(int index, const QString &role) override;
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
@@ -311,7 +311,8 @@ bool ListModel::sync(ListModel *src, ListModel *target)
 
     QQmlListModel *targetModel = target->m_modelCache;
 
-    // Get list of elements that are in the target but no longer in the source. These get deleted first.
+    // Get list of elements that are in the target but no longer in the source. These get deleted first,
+    // with consecutive elements removed in one go.
     int rowsRemoved = 0;
     for (int i = 0 ; i < target->elements.count() ; ++i) {
         ListElement *element = target->elements.at(i);
@@ -321,15 +322,24 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         s.targetIndex -= rowsRemoved;
         if (s.src == nullptr) {
             Q_ASSERT(s.targetIndex == i);
+            int count = 1;
+            while (i + count < target->elements.count()
+                   && elementHash.find(target->elements.at(i + count)->getUid()).value().src == nullptr) {
+                ++count;
+            }
+
             hasChanges = true;
             if (targetModel)
-                targetModel->beginRemoveRows(QModelIndex(), i, i);
-            s.target->destroy(target->m_layout);
-            target->elements.removeOne(s.target);
-            delete s.target;
+                targetModel->beginRemoveRows(QModelIndex(), i, i + count - 1);
+            for (int j = i; j < i + count; ++j) {
+                ListElement *removed = target->elements.at(j);
+                removed->destroy(target->m_layout);
+                delete removed;
+            }
+            target->elements.remove(i, count);
             if (targetModel)
                 targetModel->endRemoveRows();
-            ++rowsRemoved;
+            rowsRemoved += count;
             --i;
             continue;
         }
@@ -338,8 +348,17 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     // Sync the layouts
     ListLayout::sync(src->m_layout, target->m_layout);
 
+    // Elements that were not modified on either side since the last sync can be skipped,
+    // unless they hold nested models: changes to those are not tracked by the element that
+    // owns them. Elements modified only in the target are synced too, so that the source's
+    // values replace them as before.
+    bool syncAllElements = false;
+    for (int i = 0; i < src->m_layout->roleCount() && !syncAllElements; ++i)
+        syncAllElements = src->m_layout->getExistingRole(i).type == ListLayout::Role::List;
+
     // Clear the target list, and append in correct order from the source
     target->elements.clear();
+    target->elements.reserve(src->elements.count());
     for (int i = 0; i < src->elements.count(); ++i) {
         ListElement *srcElement = src->elements.at(i);
         ElementSync &s = elementHash.find(srcElement->getUid()).value();
@@ -348,7 +367,10 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         if (targetElement == nullptr) {
             targetElement = new ListElement(srcElement->getUid());
         }
-        s.changedRoles = ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout);
+        if (s.target == nullptr || srcElement->m_dirty || targetElement->m_dirty || syncAllElements)
+            s.changedRoles = ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout);
+        srcElement->m_dirty = false;
+        targetElement->m_dirty = false;
         target->elements.append(targetElement);
     }
 
@@ -366,32 +388,66 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     //
     // to ensure things are kept in the correct order, emit inserts and moves first. This shouls ensure all persistent
     // model indices are updated correctly
+    //
+    // consecutive inserted elements, and consecutive changed elements, are reported as a single range so that
+    // views process one change set per sync rather than one per element
+    int changedFrom = -1;
+    int changedTo = -1;
+    QVector<int> changedRoles;
+    auto emitDataChanged = [&]() {
+        if (changedFrom == -1)
+            return;
+        if (targetModel)
+            emit targetModel->dataChanged(targetModel->createIndex(changedFrom, 0), targetModel->createIndex(changedTo, 0), changedRoles);
+        changedFrom = changedTo = -1;
+        changedRoles.clear();
+    };
+
     int rowsInserted = 0;
     for (int i = 0 ; i < target->elements.count() ; ++i) {
         ListElement *element = target->elements.at(i);
         ElementSync &s = elementHash.find(element->getUid()).value();
         Q_ASSERT(s.srcIndex >= 0);
         s.srcIndex += rowsInserted;
+        if (s.targetIndex == -1) {
+            int count = 1;
+            while (i + count < target->elements.count()
+                   && elementHash.find(target->elements.at(i + count)->getUid()).value().targetIndex == -1) {
+                ++count;
+            }
+            emitDataChanged();
+            if (targetModel) {
+                targetModel->beginInsertRows(QModelIndex(), i, i + count - 1);
+                targetModel->endInsertRows();
+            }
+            hasChanges = true;
+            rowsInserted += count;
+            i += count - 1;
+            continue;
+        }
         if (s.srcIndex != s.targetIndex) {
+            emitDataChanged();
             if (targetModel) {
-                if (s.targetIndex == -1) {
-                    targetModel->beginInsertRows(QModelIndex(), i, i);
-                    targetModel->endInsertRows();
-                } else {
-                    targetModel->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
-                    targetModel->endMoveRows();
-                }
+                targetModel->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
+                targetModel->endMoveRows();
             }
             hasChanges = true;
             ++rowsInserted;
         }
-        if (s.targetIndex != -1 && !s.changedRoles.isEmpty()) {
-            QModelIndex idx = targetModel->createIndex(i, 0);
-            if (targetModel)
-                targetModel->dataChanged(idx, idx, s.changedRoles);
+        if (!s.changedRoles.isEmpty()) {
+            if (changedFrom != -1 && changedTo != i - 1)
+                emitDataChanged();
+            if (changedFrom == -1)
+                changedFrom = i;
+            changedTo = i;
+            for (int role : qAsConst(s.changedRoles)) {
+                if (!changedRoles.contains(role))
+                    changedRoles.append(role);
+            }
             hasChanges = true;
         }
     }
+    emitDataChanged();
     return hasChanges;
 }
 
@@ -423,6 +479,14 @@ void ListModel::insertElement(int index)
     updateCacheIndices(index);
 }
 
+void ListModel::insertElements(int index, int count)
+{
+    elements.insertBlank(index, count);
+    for (int i = index; i < index + count; ++i)
+        elements[i] = new ListElement;
+    updateCacheIndices(index + count);
+}
+
 void ListModel::move(int from, int to, int n)
 {
     if (from > to) {
@@ -483,6 +547,7 @@ ListModel *ListModel::getListProperty(int elementIndex, const ListLayout::Role &
 void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
 {
     ListElement *e = elements[elementIndex];
+    e->m_dirty = true;
 
     QV4::ExecutionEngine *v4 = object->engine();
     QV4::Scope scope(v4);
@@ -563,6 +628,7 @@ void ListModel::set(int elementIndex, QV4::Object *object)
         return;
 
     ListElement *e = elements[elementIndex];
+    e->m_dirty = true;
 
     QV4::ExecutionEngine *v4 = object->engine();
     QV4::Scope scope(v4);
@@ -658,6 +724,66 @@ int ListModel::append(QV4::Object *object)
     return elementIndex;
 }
 
+/*
+    Sets the role \a roleName of the elements starting at \a firstElementIndex
+    to consecutive entries of \a values. The role type is taken from the first
+    value that is not null or undefined, and the role is looked up only once
+    for the whole column. Values of a different type are skipped.
+
+    The elements must be newly created, as existing values are not destroyed.
+*/
+bool ListModel::setColumn(int firstElementIndex, QV4::String *roleName, QV4::ArrayObject *values)
+{
+    QV4::Scope scope(values->engine());
+    QV4::ScopedValue value(scope);
+
+    const int valueCount = qMin(int(values->getLength()), elements.count() - firstElementIndex);
+    ListLayout::Role::DataType type = ListLayout::Role::Invalid;
+    for (int i = 0; i < valueCount && type == ListLayout::Role::Invalid; ++i) {
+        value = values->getIndexed(i);
+        if (value->isNullOrUndefined())
+            continue;
+        if (value->stringValue())
+            type = ListLayout::Role::String;
+        else if (value->isNumber())
+            type = ListLayout::Role::Number;
+        else if (value->isBoolean())
+            type = ListLayout::Role::Bool;
+        else
+            return false;
+    }
+
+    if (type == ListLayout::Role::Invalid)
+        return true;
+
+    const ListLayout::Role &r = m_layout->getRoleOrCreate(roleName, type);
+    if (r.type != type)
+        return true;
+
+    for (int i = 0; i < valueCount; ++i) {
+        value = values->getIndexed(i);
+        ListElement *e = elements[firstElementIndex + i];
+        switch (type) {
+        case ListLayout::Role::String:
+            if (QV4::String *s = value->stringValue())
+                e->setStringPropertyFast(r, s->toQString());
+            break;
+        case ListLayout::Role::Number:
+            if (value->isNumber())
+                e->setDoublePropertyFast(r, value->asDouble());
+            break;
+        case ListLayout::Role::Bool:
+            if (value->isBoolean())
+                e->setBoolPropertyFast(r, value->booleanValue());
+            break;
+        default:
+            break;
+        }
+    }
+
+    return true;
+}
+
 int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const QVariant &data)
 {
     int roleIndex = -1;
@@ -668,6 +794,7 @@ int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const Q
         const ListLayout::Role *r = m_layout->getRoleOrCreate(key, data);
         if (r) {
             roleIndex = e->setVariantProperty(*r, data);
+            e->m_dirty = true;
 
             ModelNodeMetaObject *cache = e->objectCache();
 
@@ -686,8 +813,10 @@ int ListModel::setExistingProperty(int elementIndex, const QString &key, const Q
     if (elementIndex >= 0 && elementIndex < elements.count()) {
         ListElement *e = elements[elementIndex];
         const ListLayout::Role *r = m_layout->getExistingRole(key);
-        if (r)
+        if (r) {
             roleIndex = e->setJsProperty(*r, data, eng);
+            e->m_dirty = true;
+        }
     }
 
     return roleIndex;
@@ -698,10 +827,8 @@ inline char *ListElement::getPropertyMemory(const ListLayout::Role &role)
     ListElement *e = this;
     int blockIndex = 0;
     while (blockIndex < role.blockIndex) {
-        if (e->next == nullptr) {
-            e->next = new ListElement;
-            e->next->uid = uid;
-        }
+        if (e->next == nullptr)
+            e->next = new ListElement(uid);
         e = e->next;
         ++blockIndex;
     }
@@ -1137,6 +1264,7 @@ ListElement::ListElement()
 {
     m_objectCache = nullptr;
     uid = uidCounter.fetchAndAddOrdered(1);
+    m_dirty = true;
     next = nullptr;
     memset(data, 0, sizeof(data));
 }
@@ -1145,6 +1273,7 @@ ListElement::ListElement(int existingUid)
 {
     m_objectCache = nullptr;
     uid = existingUid;
+    m_dirty = true;
     next = nullptr;
     memset(data, 0, sizeof(data));
 }
@@ -2243,13 +2372,19 @@ void QQmlListModel::insert(QQmlV4Function *args)
 
             int objectArrayLength = objectArray->getLength();
             emitItemsAboutToBeInserted(index, objectArrayLength);
+
+            // Make room for all the new elements at once, rather than moving
+            // the tail of the list for each of them.
+            if (!m_dynamicRoles)
+                m_listModel->insertElements(index, objectArrayLength);
+
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
                     m_modelObjects.insert(index+i, DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
                 } else {
-                    m_listModel->insert(index+i, argObject);
+                    m_listModel->set(index+i, argObject);
                 }
             }
             emitItemsInserted();
@@ -2355,6 +2490,11 @@ void QQmlListModel::append(QQmlV4Function *args)
                 int index = count();
                 emitItemsAboutToBeInserted(index, objectArrayLength);
 
+                if (m_dynamicRoles)
+                    m_modelObjects.reserve(index + objectArrayLength);
+                else
+                    m_listModel->reserve(index + objectArrayLength);
+
                 for (int i=0 ; i < objectArrayLength ; ++i) {
                     argObject = objectArray->getIndexed(i);
 
@@ -2389,6 +2529,95 @@ void QQmlListModel::append(QQmlV4Function *args)
     }
 }
 
+/*!
+    \qmlmethod ListModel::appendColumns(jsobject columns)
+    \since 5.12
+
+    Adds new items to the end of the list model, given as one array of
+    values for each role instead of one object for each item.
+
+    \code
+    fruitModel.appendColumns({ "name": ["Apple", "Orange"], "cost": [1.25, 0.95] });
+    \endcode
+
+    The number of items added is the length of the longest array. Items past
+    the end of a shorter array, or with a \c null or \c undefined entry, get
+    no value for that role. Only string, number and boolean values are
+    supported; the type of each role is that of the first value in its array,
+    and entries of another type are ignored.
+
+    Because every role is looked up once per array rather than once per item,
+    and no object has to be created for every item, this is considerably
+    faster than append() for large numbers of items.
+
+    \sa append()
+*/
+void QQmlListModel::appendColumns(QQmlV4Function *args)
+{
+    QV4::Scope scope(args->v4engine());
+    QV4::ScopedObject columns(scope, (*args)[0]);
+    if (args->length() != 1 || !columns || columns->as<QV4::ArrayObject>()) {
+        qmlWarning(this) << tr("appendColumns: value is not an object");
+        return;
+    }
+
+    QV4::ScopedString roleName(scope);
+    QV4::ScopedValue columnValue(scope);
+    QV4::ScopedArrayObject column(scope);
+
+    int newCount = 0;
+    {
+        QV4::ObjectIterator it(scope, columns, QV4::ObjectIterator::EnumerableOnly);
+        while ((roleName = it.nextPropertyNameAsString(columnValue))) {
+            column = columnValue;
+            if (!column) {
+                qmlWarning(this) << tr("appendColumns: value of role %1 is not an array").arg(roleName->toQString());
+                return;
+            }
+            newCount = qMax(newCount, int(column->getLength()));
+        }
+    }
+
+    if (newCount == 0)
+        return;
+
+    const int index = count();
+    emitItemsAboutToBeInserted(index, newCount);
+
+    if (m_dynamicRoles) {
+        QVector<QVariantMap> values(newCount);
+        QV4::ScopedValue value(scope);
+        QV4::ObjectIterator it(scope, columns, QV4::ObjectIterator::EnumerableOnly);
+        while ((roleName = it.nextPropertyNameAsString(columnValue))) {
+            column = columnValue;
+            const QString name = roleName->toQString();
+            const int length = column->getLength();
+            for (int i = 0; i < length; ++i) {
+                value = column->getIndexed(i);
+                if (!value->isNullOrUndefined())
+                    values[i].insert(name, scope.engine->toVariant(value, -1));
+            }
+        }
+
+        m_modelObjects.reserve(index + newCount);
+        for (const QVariantMap &object : qAsConst(values))
+            m_modelObjects.append(DynamicRoleModelNode::create(object, this));
+    } else {
+        m_listModel->reserve(index + newCount);
+        for (int i = 0; i < newCount; ++i)
+            m_listModel->appendElement();
+
+        QV4::ObjectIterator it(scope, columns, QV4::ObjectIterator::EnumerableOnly);
+        while ((roleName = it.nextPropertyNameAsString(columnValue))) {
+            column = columnValue;
+            if (!m_listModel->setColumn(index, roleName, column))
+                qmlWarning(this) << tr("appendColumns: unsupported value type for role %1").arg(roleName->toQString());
+        }
+    }
+
+    emitItemsInserted();
+}
+
 /*!
     \qmlmethod object ListModel::get(int index)
 
@@ -97,6 +97,7 @@ public:
     Q_INVOKABLE void clear();
     Q_INVOKABLE void remove(QQmlV4Function *args);
     Q_INVOKABLE void append(QQmlV4Function *args);
+    Q_INVOKABLE void appendColumns(QQmlV4Function *args);
     Q_INVOKABLE void insert(QQmlV4Function *args);
     Q_INVOKABLE QQmlV4Handle get(int index) const;
     Q_INVOKABLE void set(int index, const QQmlV4Handle &);
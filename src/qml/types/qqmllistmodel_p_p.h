@@ -318,6 +318,8 @@ private:
     ListElement *next;
 
     int uid;
+    // Whether the element was modified since it was last synced to or from another model.
+    bool m_dirty;
     QObject *m_objectCache;
 
     friend class ListModel;
@@ -376,6 +378,10 @@ public:
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
+    void reserve(int count) { elements.reserve(count); }
+
+    bool setColumn(int firstElementIndex, QV4::String *roleName, QV4::ArrayObject *values);
 
     void move(int from, int to, int n);
 
@@ -109,6 +109,11 @@ void QQmlListModelWorkerAgent::append(QQmlV4Function *args)
     m_copy->append(args);
 }
 
+void QQmlListModelWorkerAgent::appendColumns(QQmlV4Function *args)
+{
+    m_copy->appendColumns(args);
+}
+
 void QQmlListModelWorkerAgent::insert(QQmlV4Function *args)
 {
     m_copy->insert(args);
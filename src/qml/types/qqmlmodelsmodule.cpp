@@ -61,6 +61,10 @@ void QQmlModelsModule::defineModule()
     qmlRegisterType<QQmlObjectModel,3>(uri, 2, 3, "ObjectModel");
 
     qmlRegisterType<QItemSelectionModel>(uri, 2, 2, "ItemSelectionModel");
+
+#if QT_CONFIG(qml_delegate_model)
+    qmlRegisterType<QQmlDelegateModelGroup, 12>(uri, 2, 12, "DelegateModelGroup");
+#endif
 }
 
 QT_END_NAMESPACE
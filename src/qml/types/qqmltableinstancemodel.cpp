@@ -0,0 +1,427 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qqmltableinstancemodel_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtQml/qqmlinfo.h>
+
+#include <private/qqmlchangeset_p.h>
+#include <private/qqmlcomponent_p.h>
+#include <private/qqmlengine_p.h>
+
+QT_BEGIN_NAMESPACE
+
+static bool isDoneIncubating(QQmlIncubator::Status status)
+{
+    return status == QQmlIncubator::Ready || status == QQmlIncubator::Error;
+}
+
+void QQmlTableInstanceModelIncubationTask::statusChanged(Status status)
+{
+    if (tableInstanceModel)
+        tableInstanceModel->incubatorStatusChanged(this, status);
+    else
+        QQDMIncubationTask::statusChanged(status);
+}
+
+void QQmlTableInstanceModelIncubationTask::setInitialState(QObject *object)
+{
+    if (tableInstanceModel)
+        tableInstanceModel->setInitialState(this, object);
+    else
+        incubating->object = object;
+}
+
+/*
+  QQmlTableInstanceModel creates delegate instances for the cells of a two
+  dimensional model. Unlike QQmlDelegateModel it does not keep track of the
+  model's structure through a list compositor: a cell is addressed by its
+  row and column, and any change to the model's layout is reported to the
+  view as a reset.
+*/
+QQmlTableInstanceModel::QQmlTableInstanceModel(QQmlContext *qmlContext, QObject *parent)
+    : QQmlInstanceModel(*(new QObjectPrivate()), parent)
+    , m_qmlContext(qmlContext)
+    , m_metaType(new QQmlDelegateModelItemMetaType(qmlContext->engine()->handle(), nullptr, QStringList()))
+    , m_incubationCleanupScheduled(false)
+{
+}
+
+QQmlTableInstanceModel::~QQmlTableInstanceModel()
+{
+    const QList<QQmlDelegateModelItem *> modelItems = m_modelItems.values() + m_reusableItemsPool;
+    for (QQmlDelegateModelItem *modelItem : modelItems) {
+        modelItem->objectRef = 0;
+        if (modelItem->incubationTask) {
+            // Let the incubation task clean up the item once it's done.
+            static_cast<QQmlTableInstanceModelIncubationTask *>(modelItem->incubationTask)->tableInstanceModel = nullptr;
+            continue;
+        }
+
+        if (modelItem->object) {
+            delete modelItem->object;
+            modelItem->object = nullptr;
+        }
+        if (modelItem->contextData) {
+            modelItem->contextData->invalidate();
+            modelItem->contextData = nullptr;
+        }
+        modelItem->Dispose();
+    }
+
+    qDeleteAll(m_finishedIncubationTasks);
+    m_metaType->release();
+}
+
+QVariant QQmlTableInstanceModel::model() const
+{
+    return m_adaptorModel.model();
+}
+
+void QQmlTableInstanceModel::setModel(const QVariant &model)
+{
+    if (QAbstractItemModel *aim = qobject_cast<QAbstractItemModel *>(m_adaptorModel.object()))
+        disconnect(aim, nullptr, this, nullptr);
+
+    // Pooled items were created for the old model's data type.
+    drainReusableItemsPool(0);
+
+    m_adaptorModel.setModel(model, nullptr, m_qmlContext ? m_qmlContext->engine() : nullptr);
+
+    if (QAbstractItemModel *aim = qobject_cast<QAbstractItemModel *>(m_adaptorModel.object())) {
+        connect(aim, &QAbstractItemModel::dataChanged, this, &QQmlTableInstanceModel::_q_dataChanged);
+        connect(aim, &QAbstractItemModel::modelReset, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::layoutChanged, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::rowsInserted, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::rowsRemoved, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::rowsMoved, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::columnsInserted, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::columnsRemoved, this, &QQmlTableInstanceModel::_q_layoutChanged);
+        connect(aim, &QAbstractItemModel::columnsMoved, this, &QQmlTableInstanceModel::_q_layoutChanged);
+    }
+
+    emit countChanged();
+}
+
+QQmlComponent *QQmlTableInstanceModel::delegate() const
+{
+    return m_delegate;
+}
+
+void QQmlTableInstanceModel::setDelegate(QQmlComponent *delegate)
+{
+    if (m_delegate == delegate)
+        return;
+
+    drainReusableItemsPool(0);
+    m_delegate = delegate;
+}
+
+/*
+  Returns the delegate instance for the cell at \a index, creating it if
+  needed. If the delegate is created asynchronously, nullptr is returned and
+  createdItem() is emitted once it is ready, or with a null object if it
+  failed; object() must then be called again from that signal to keep the
+  instance. Every call that returns an
+  object must be matched by a call to release().
+*/
+QObject *QQmlTableInstanceModel::object(int index, QQmlIncubator::IncubationMode incubationMode)
+{
+    if (!m_delegate || index < 0 || index >= count()) {
+        qWarning() << "TableView: cell index out of range" << index << count();
+        return nullptr;
+    }
+
+    const int row = rowAt(index);
+    const int column = columnAt(index);
+    QQmlDelegateModelItem *modelItem = resolveModelItem(row, column);
+    if (!modelItem)
+        return nullptr;
+
+    // Hold a reference while incubating, so that a synchronous
+    // incubation cannot destroy the item from under us.
+    modelItem->referenceObject();
+    if (!modelItem->object || modelItem->incubationTask)
+        incubateModelItem(modelItem, incubationMode);
+
+    if (modelItem->object && !modelItem->incubationTask)
+        return modelItem->object;
+
+    modelItem->releaseObject();
+    if (!modelItem->incubationTask) {
+        // Creating the delegate failed, there is nothing to keep.
+        m_modelItems.remove(cellKey(row, column));
+        destroyModelItem(modelItem);
+    }
+    return nullptr;
+}
+
+QQmlInstanceModel::ReleaseFlags QQmlTableInstanceModel::release(QObject *object, ReusableFlag reusableFlag)
+{
+    QQmlDelegateModelItem *modelItem = object ? QQmlDelegateModelItem::dataForObject(object) : nullptr;
+    if (!modelItem)
+        return nullptr;
+
+    if (!modelItem->releaseObject())
+        return QQmlInstanceModel::Referenced;
+
+    const int row = modelItem->modelIndex();
+    const int column = modelItem->modelColumn();
+    m_modelItems.remove(cellKey(row, column));
+
+    if (reusableFlag == Reusable && isReusable(modelItem)) {
+        modelItem->poolTime = 0;
+        m_reusableItemsPool.append(modelItem);
+        emit itemPooled(indexAt(row, column), object);
+        return QQmlInstanceModel::Pooled;
+    }
+
+    destroyModelItem(modelItem);
+    return QQmlInstanceModel::Destroyed;
+}
+
+/*
+  Destroys the pooled delegate instances that have not been reused during the
+  last \a maxPoolTime calls.
+*/
+void QQmlTableInstanceModel::drainReusableItemsPool(int maxPoolTime)
+{
+    for (int i = m_reusableItemsPool.count() - 1; i >= 0; --i) {
+        QQmlDelegateModelItem *modelItem = m_reusableItemsPool.at(i);
+        if (++modelItem->poolTime <= maxPoolTime)
+            continue;
+        m_reusableItemsPool.removeAt(i);
+        destroyModelItem(modelItem);
+    }
+}
+
+QQmlIncubator::Status QQmlTableInstanceModel::incubationStatus(int index)
+{
+    const QQmlDelegateModelItem *modelItem = m_modelItems.value(cellKey(rowAt(index), columnAt(index)));
+    if (!modelItem)
+        return QQmlIncubator::Null;
+    if (modelItem->incubationTask)
+        return modelItem->incubationTask->status();
+    return modelItem->object ? QQmlIncubator::Ready : QQmlIncubator::Null;
+}
+
+int QQmlTableInstanceModel::indexOf(QObject *object, QObject *objectContext) const
+{
+    Q_UNUSED(objectContext);
+    if (QQmlDelegateModelItem *modelItem = QQmlDelegateModelItem::dataForObject(object))
+        return indexAt(modelItem->modelIndex(), modelItem->modelColumn());
+    return -1;
+}
+
+bool QQmlTableInstanceModel::event(QEvent *e)
+{
+    if (e->type() == QEvent::User) {
+        m_incubationCleanupScheduled = false;
+        qDeleteAll(m_finishedIncubationTasks);
+        m_finishedIncubationTasks.clear();
+    }
+    return QQmlInstanceModel::event(e);
+}
+
+void QQmlTableInstanceModel::_q_dataChanged(const QModelIndex &begin, const QModelIndex &end, const QVector<int> &roles)
+{
+    if (m_adaptorModel.rootIndex != begin.parent())
+        return;
+
+    QList<QQmlDelegateModelItem *> modelItems;
+    for (QQmlDelegateModelItem *modelItem : qAsConst(m_modelItems)) {
+        const int column = modelItem->modelColumn();
+        if (column >= begin.column() && column <= end.column())
+            modelItems.append(modelItem);
+    }
+    m_adaptorModel.notify(modelItems, begin.row(), end.row() - begin.row() + 1, roles);
+}
+
+void QQmlTableInstanceModel::_q_layoutChanged()
+{
+    // Cells are not tracked through structural changes; the view reloads
+    // everything it shows, and can pick up the pooled items when doing so.
+    emit modelUpdated(QQmlChangeSet(), true);
+    emit countChanged();
+}
+
+QQmlDelegateModelItem *QQmlTableInstanceModel::resolveModelItem(int row, int column)
+{
+    const quint64 key = cellKey(row, column);
+    QQmlDelegateModelItem *modelItem = m_modelItems.value(key);
+    if (modelItem)
+        return modelItem;
+
+    if (!m_reusableItemsPool.isEmpty()) {
+        modelItem = m_reusableItemsPool.takeLast();
+        m_modelItems.insert(key, modelItem);
+        modelItem->setModelColumn(column);
+        modelItem->reuse(m_adaptorModel, row);
+        setCellContextProperties(modelItem);
+        emit itemReused(indexAt(row, column), modelItem->object);
+        return modelItem;
+    }
+
+    modelItem = m_adaptorModel.createItem(m_metaType, row);
+    if (!modelItem)
+        return nullptr;
+
+    // The model's own reference, dropped in destroyModelItem().
+    modelItem->scriptRef += 1;
+    modelItem->setModelColumn(column);
+    m_modelItems.insert(key, modelItem);
+    return modelItem;
+}
+
+void QQmlTableInstanceModel::incubateModelItem(QQmlDelegateModelItem *modelItem, QQmlIncubator::IncubationMode incubationMode)
+{
+    if (modelItem->incubationTask) {
+        // Previously requested async - force completion if it's now needed immediately.
+        const bool sync = incubationMode == QQmlIncubator::Synchronous
+                || incubationMode == QQmlIncubator::AsynchronousIfNested;
+        if (sync && modelItem->incubationTask->incubationMode() == QQmlIncubator::Asynchronous)
+            modelItem->incubationTask->forceCompletion();
+        return;
+    }
+
+    QQmlContext *creationContext = m_delegate->creationContext();
+    QQmlContextData *ctxt = new QQmlContextData;
+    ctxt->setParent(QQmlContextData::get(creationContext ? creationContext : m_qmlContext.data()));
+    ctxt->contextObject = modelItem;
+    modelItem->contextData = ctxt;
+    setCellContextProperties(modelItem);
+
+    if (m_adaptorModel.hasProxyObject()) {
+        if (QQmlAdaptorModelProxyInterface *proxy
+                = qobject_cast<QQmlAdaptorModelProxyInterface *>(modelItem)) {
+            ctxt = new QQmlContextData;
+            ctxt->setParent(modelItem->contextData, /*stronglyReferencedByParent*/true);
+            ctxt->contextObject = proxy->proxiedObject();
+        }
+    }
+
+    modelItem->incubationTask = new QQmlTableInstanceModelIncubationTask(this, modelItem, incubationMode);
+    QQmlComponentPrivate::get(m_delegate)->incubateObject(
+                modelItem->incubationTask,
+                m_delegate,
+                m_qmlContext->engine(),
+                ctxt,
+                QQmlContextData::get(m_qmlContext));
+}
+
+void QQmlTableInstanceModel::incubatorStatusChanged(QQmlTableInstanceModelIncubationTask *incubationTask, QQmlIncubator::Status status)
+{
+    if (!isDoneIncubating(status))
+        return;
+
+    QQmlDelegateModelItem *modelItem = incubationTask->incubating;
+    modelItem->incubationTask = nullptr;
+    incubationTask->incubating = nullptr;
+    deleteIncubationTaskLater(incubationTask);
+
+    const int row = modelItem->modelIndex();
+    const int column = modelItem->modelColumn();
+
+    if (status == QQmlIncubator::Ready) {
+        modelItem->referenceObject();
+        emit createdItem(indexAt(row, column), modelItem->object);
+        modelItem->releaseObject();
+    } else {
+        qmlWarning(m_delegate, incubationTask->errors() + m_delegate->errors()) << "Error creating delegate";
+        emit createdItem(indexAt(row, column), nullptr);
+    }
+
+    if (!modelItem->isObjectReferenced()) {
+        // Nobody picked up the object when it became ready, so it is no longer needed.
+        m_modelItems.remove(cellKey(row, column));
+        destroyModelItem(modelItem);
+    }
+}
+
+void QQmlTableInstanceModel::setInitialState(QQmlTableInstanceModelIncubationTask *incubationTask, QObject *object)
+{
+    QQmlDelegateModelItem *modelItem = incubationTask->incubating;
+    modelItem->object = object;
+    emit initItem(indexAt(modelItem->modelIndex(), modelItem->modelColumn()), object);
+}
+
+void QQmlTableInstanceModel::deleteIncubationTaskLater(QQmlIncubator *incubationTask)
+{
+    if (!incubationTask->isError())
+        incubationTask->clear();
+    m_finishedIncubationTasks.append(incubationTask);
+    if (!m_incubationCleanupScheduled) {
+        m_incubationCleanupScheduled = true;
+        QCoreApplication::postEvent(this, new QEvent(QEvent::User));
+    }
+}
+
+void QQmlTableInstanceModel::setCellContextProperties(QQmlDelegateModelItem *modelItem)
+{
+    QQmlContext *context = modelItem->contextData->asQQmlContext();
+    context->setContextProperty(QStringLiteral("row"), modelItem->modelIndex());
+    context->setContextProperty(QStringLiteral("column"), modelItem->modelColumn());
+}
+
+bool QQmlTableInstanceModel::isReusable(QQmlDelegateModelItem *modelItem) const
+{
+    // Object models proxy the model object through a separate context, so
+    // their instances cannot be moved to a different object.
+    return modelItem->object
+            && !modelItem->incubationTask
+            && !m_adaptorModel.hasProxyObject();
+}
+
+void QQmlTableInstanceModel::destroyModelItem(QQmlDelegateModelItem *modelItem)
+{
+    if (QObject *object = modelItem->object) {
+        modelItem->destroyObject();
+        emit destroyingItem(object);
+    } else if (modelItem->contextData) {
+        modelItem->contextData->invalidate();
+        modelItem->contextData = nullptr;
+    }
+    modelItem->Dispose();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qqmltableinstancemodel_p.cpp"
@@ -0,0 +1,164 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQMLTABLEINSTANCEMODEL_P_H
+#define QQMLTABLEINSTANCEMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qqmldelegatemodel_p.h>
+#include <private/qqmldelegatemodel_p_p.h>
+
+#include <limits>
+
+QT_REQUIRE_CONFIG(qml_delegate_model);
+
+QT_BEGIN_NAMESPACE
+
+class QQmlTableInstanceModel;
+
+class QQmlTableInstanceModelIncubationTask : public QQDMIncubationTask
+{
+public:
+    QQmlTableInstanceModelIncubationTask(
+            QQmlTableInstanceModel *tableInstanceModel,
+            QQmlDelegateModelItem *modelItemToIncubate,
+            IncubationMode mode)
+        : QQDMIncubationTask(nullptr, mode)
+        , tableInstanceModel(tableInstanceModel)
+    {
+        incubating = modelItemToIncubate;
+    }
+
+    void statusChanged(Status status) override;
+    void setInitialState(QObject *object) override;
+
+    QQmlTableInstanceModel *tableInstanceModel;
+};
+
+class Q_QML_PRIVATE_EXPORT QQmlTableInstanceModel : public QQmlInstanceModel
+{
+    Q_OBJECT
+
+public:
+    QQmlTableInstanceModel(QQmlContext *qmlContext, QObject *parent = nullptr);
+    ~QQmlTableInstanceModel() override;
+
+    int count() const override { return rows() * columns(); }
+    int rows() const { return m_adaptorModel.count(); }
+
+    // Cells are indexed with an int, so the columns beyond those which can all be
+    // indexed are left out rather than letting count() and indexAt() overflow.
+    int columns() const {
+        const int rowCount = rows();
+        const int columnCount = m_adaptorModel.columnCount();
+        return rowCount > 0 ? qMin(columnCount, std::numeric_limits<int>::max() / rowCount) : columnCount;
+    }
+
+    // Cells are numbered column by column, so that index() == row() for single column models.
+    int indexAt(int row, int column) const { return column * rows() + row; }
+    int rowAt(int index) const { return rows() > 0 ? index % rows() : -1; }
+    int columnAt(int index) const { return rows() > 0 ? index / rows() : -1; }
+
+    bool isValid() const override { return true; }
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *);
+
+    QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
+    ReleaseFlags release(QObject *object, ReusableFlag reusableFlag = NotReusable) override;
+
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override { return m_reusableItemsPool.count(); }
+
+    QQmlIncubator::Status incubationStatus(int index) override;
+
+    QString stringValue(int, const QString &) override { return QString(); }
+    void setWatchedRoles(const QList<QByteArray> &) override {}
+
+    int indexOf(QObject *object, QObject *objectContext) const override;
+
+protected:
+    bool event(QEvent *event) override;
+
+private Q_SLOTS:
+    void _q_dataChanged(const QModelIndex &begin, const QModelIndex &end, const QVector<int> &roles);
+    void _q_layoutChanged();
+
+private:
+    static quint64 cellKey(int row, int column) { return (quint64(quint32(row)) << 32) | quint32(column); }
+
+    QQmlDelegateModelItem *resolveModelItem(int row, int column);
+    void incubateModelItem(QQmlDelegateModelItem *modelItem, QQmlIncubator::IncubationMode incubationMode);
+    void incubatorStatusChanged(QQmlTableInstanceModelIncubationTask *incubationTask, QQmlIncubator::Status status);
+    void setInitialState(QQmlTableInstanceModelIncubationTask *incubationTask, QObject *object);
+    void deleteIncubationTaskLater(QQmlIncubator *incubationTask);
+    void setCellContextProperties(QQmlDelegateModelItem *modelItem);
+    bool isReusable(QQmlDelegateModelItem *modelItem) const;
+    void destroyModelItem(QQmlDelegateModelItem *modelItem);
+
+    QQmlAdaptorModel m_adaptorModel;
+    QPointer<QQmlContext> m_qmlContext;
+    QPointer<QQmlComponent> m_delegate;
+    QQmlDelegateModelItemMetaType *m_metaType;
+
+    QHash<quint64, QQmlDelegateModelItem *> m_modelItems;
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
+    QList<QQmlIncubator *> m_finishedIncubationTasks;
+    bool m_incubationCleanupScheduled;
+
+    friend class QQmlTableInstanceModelIncubationTask;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQMLTABLEINSTANCEMODEL_P_H
@@ -26,11 +26,13 @@ HEADERS += \
 
 qtConfig(qml-delegate-model) {
     SOURCES += \
-        $$PWD/qqmldelegatemodel.cpp
+        $$PWD/qqmldelegatemodel.cpp \
+        $$PWD/qqmltableinstancemodel.cpp
 
     HEADERS += \
         $$PWD/qqmldelegatemodel_p.h \
-        $$PWD/qqmldelegatemodel_p_p.h
+        $$PWD/qqmldelegatemodel_p_p.h \
+        $$PWD/qqmltableinstancemodel_p.h
 }
 
 qtConfig(animation) {
@@ -105,12 +105,16 @@ public:
 
     void setValue(const QString &role, const QVariant &value) override;
     bool resolveIndex(const QQmlAdaptorModel &model, int idx) override;
+    void reuse(const QQmlAdaptorModel &model, int idx) override;
 
     static QV4::ReturnedValue get_property(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
     static QV4::ReturnedValue set_property(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
 
     VDMModelDelegateDataType *type;
     QVector<QVariant> cachedData;
+
+protected:
+    void setIndex(int idx);
 };
 
 class VDMModelDelegateDataType
@@ -329,20 +333,30 @@ void QQmlDMCachedModelData::setValue(const QString &role, const QVariant &value)
 bool QQmlDMCachedModelData::resolveIndex(const QQmlAdaptorModel &, int idx)
 {
     if (index == -1) {
-        Q_ASSERT(idx >= 0);
-        index = idx;
-        cachedData.clear();
-        emit modelIndexChanged();
-        const QMetaObject *meta = metaObject();
-        const int propertyCount = type->propertyRoles.count();
-        for (int i = 0; i < propertyCount; ++i)
-            QMetaObject::activate(this, meta, i, nullptr);
+        setIndex(idx);
         return true;
     } else {
         return false;
     }
 }
 
+void QQmlDMCachedModelData::reuse(const QQmlAdaptorModel &, int idx)
+{
+    setIndex(idx);
+}
+
+void QQmlDMCachedModelData::setIndex(int idx)
+{
+    Q_ASSERT(idx >= 0);
+    index = idx;
+    cachedData.clear();
+    emit modelIndexChanged();
+    const QMetaObject *meta = metaObject();
+    const int propertyCount = type->propertyRoles.count();
+    for (int i = 0; i < propertyCount; ++i)
+        QMetaObject::activate(this, meta, i, nullptr);
+}
+
 QV4::ReturnedValue QQmlDMCachedModelData::get_property(const QV4::FunctionObject *b, const QV4::Value *thisObject, const QV4::Value *, int)
 {
     QV4::Scope scope(b);
@@ -399,7 +413,7 @@ QV4::ReturnedValue QQmlDMCachedModelData::set_property(const QV4::FunctionObject
 class QQmlDMAbstractItemModelData : public QQmlDMCachedModelData
 {
     Q_OBJECT
-    Q_PROPERTY(bool hasModelChildren READ hasModelChildren CONSTANT)
+    Q_PROPERTY(bool hasModelChildren READ hasModelChildren NOTIFY hasModelChildrenChanged)
 public:
     QQmlDMAbstractItemModelData(
             QQmlDelegateModelItemMetaType *metaType,
@@ -413,21 +427,24 @@ public:
     {
         if (index >= 0 && *type->model) {
             const QAbstractItemModel * const model = type->model->aim();
-            return model->hasChildren(model->index(index, 0, type->model->rootIndex));
+            return model->hasChildren(model->index(index, column, type->model->rootIndex));
         } else {
             return false;
         }
     }
 
-    QVariant value(int role) const override
+    void reuse(const QQmlAdaptorModel &model, int idx) override
     {
-        return type->model->aim()->index(index, 0, type->model->rootIndex).data(role);
+        QQmlDMCachedModelData::reuse(model, idx);
+        emit hasModelChildrenChanged();
     }
 
+    QVariant value(int role) const override;
+
     void setValue(int role, const QVariant &value) override
     {
         type->model->aim()->setData(
-                type->model->aim()->index(index, 0, type->model->rootIndex), value, role);
+                type->model->aim()->index(index, column, type->model->rootIndex), value, role);
     }
 
     QV4::ReturnedValue get() override
@@ -443,6 +460,9 @@ public:
         ++scriptRef;
         return o.asReturnedValue();
     }
+
+Q_SIGNALS:
+    void hasModelChildrenChanged();
 };
 
 class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
@@ -458,6 +478,11 @@ public:
         return model.aim()->rowCount(model.rootIndex);
     }
 
+    int columnCount(const QQmlAdaptorModel &model) const override
+    {
+        return model.aim()->columnCount(model.rootIndex);
+    }
+
     void cleanup(QQmlAdaptorModel &model, QQmlDelegateModel *vdm) const override
     {
         QAbstractItemModel * const aim = model.aim();
@@ -485,6 +510,9 @@ public:
     {
         QHash<QByteArray, int>::const_iterator it = roleNames.find(role.toUtf8());
         if (it != roleNames.end()) {
+            QVariant value;
+            if (prefetchedValue(index, *it, &value))
+                return value;
             return model.aim()->index(index, 0, model.rootIndex).data(*it);
         } else if (role == QLatin1String("hasModelChildren")) {
             return QVariant(model.aim()->hasChildren(model.aim()->index(index, 0, model.rootIndex)));
@@ -518,6 +546,82 @@ public:
             model.aim()->fetchMore(model.rootIndex);
     }
 
+    bool canPrefetch(const QQmlAdaptorModel &model) const override
+    {
+        return !model.isNull();
+    }
+
+    void prefetch(QQmlAdaptorModel &model, int index, int count) const override
+    {
+        if (!model)
+            return;
+
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        if (!metaObject)
+            dataType->initializeMetaType(model);
+
+        // The roles are requested one at a time rather than through itemData(), whose
+        // default implementation queries every one of the predefined roles.
+        const QAbstractItemModel * const aim = model.aim();
+        const int end = qMin(index + count, aim->rowCount(model.rootIndex));
+        for (int row = qMax(0, index); row < end; ++row) {
+            if (prefetched.contains(row))
+                continue;
+
+            const QModelIndex modelIndex = aim->index(row, 0, model.rootIndex);
+            QVector<QVariant> values;
+            values.reserve(propertyRoles.count());
+            for (int i = 0; i < propertyRoles.count(); ++i) {
+                // modelData repeats the model's only role.
+                values.append(hasModelData && i > 0
+                        ? values.at(0)
+                        : modelIndex.data(propertyRoles.at(i)));
+            }
+            dataType->prefetched.insert(row, values);
+        }
+    }
+
+    void trimPrefetched(QQmlAdaptorModel &, int index, int count) const override
+    {
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        for (QHash<int, QVector<QVariant> >::iterator it = dataType->prefetched.begin(); it != dataType->prefetched.end();) {
+            if (it.key() < index || it.key() >= index + count)
+                it = dataType->prefetched.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    bool notify(
+            const QQmlAdaptorModel &model,
+            const QList<QQmlDelegateModelItem *> &items,
+            int index,
+            int count,
+            const QVector<int> &roles) const override
+    {
+        // Drop the changed rows before the items are told to re-read their values.
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        for (QHash<int, QVector<QVariant> >::iterator it = dataType->prefetched.begin(); it != dataType->prefetched.end();) {
+            if (it.key() >= index && it.key() < index + count)
+                it = dataType->prefetched.erase(it);
+            else
+                ++it;
+        }
+        return VDMModelDelegateDataType::notify(model, items, index, count, roles);
+    }
+
+    bool prefetchedValue(int row, int role, QVariant *value) const
+    {
+        QHash<int, QVector<QVariant> >::const_iterator it = prefetched.constFind(row);
+        if (it == prefetched.constEnd())
+            return false;
+        const int propertyId = propertyRoles.indexOf(role);
+        if (propertyId == -1)
+            return false;
+        *value = it->at(propertyId);
+        return true;
+    }
+
     QQmlDelegateModelItem *createItem(
             QQmlAdaptorModel &model,
             QQmlDelegateModelItemMetaType *metaType,
@@ -556,8 +660,21 @@ public:
         *static_cast<QMetaObject *>(this) = *metaObject;
         propertyCache = new QQmlPropertyCache(metaObject);
     }
+
+    // Role values of rows near the view's visible range, in propertyRoles order.
+    QHash<int, QVector<QVariant> > prefetched;
 };
 
+QVariant QQmlDMAbstractItemModelData::value(int role) const
+{
+    if (column == 0) {
+        QVariant value;
+        if (static_cast<const VDMAbstractItemModelDataType *>(type)->prefetchedValue(index, role, &value))
+            return value;
+    }
+    return type->model->aim()->index(index, column, type->model->rootIndex).data(role);
+}
+
 //-----------------------------------------------------------------
 // QQmlListAccessor
 //-----------------------------------------------------------------
@@ -639,6 +756,13 @@ public:
         }
     }
 
+    void reuse(const QQmlAdaptorModel &model, int idx) override
+    {
+        index = idx;
+        cachedData = model.list.at(idx);
+        emit modelIndexChanged();
+        emit modelDataChanged();
+    }
 
 Q_SIGNALS:
     void modelDataChanged();
@@ -915,20 +1039,23 @@ void QQmlAdaptorModel::setModel(const QVariant &variant, QQmlDelegateModel *vdm,
         if (QAbstractItemModel *model = qobject_cast<QAbstractItemModel *>(object)) {
             accessors = new VDMAbstractItemModelDataType(this);
 
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsInserted(QModelIndex,int,int)),
-                              vdm, QQmlDelegateModel, SLOT(_q_rowsInserted(QModelIndex,int,int)));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),
-                              vdm,  QQmlDelegateModel, SLOT(_q_rowsRemoved(QModelIndex,int,int)));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)),
-                              vdm,  QQmlDelegateModel, SLOT(_q_rowsAboutToBeRemoved(QModelIndex,int,int)));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)),
-                              vdm, QQmlDelegateModel, SLOT(_q_dataChanged(QModelIndex,QModelIndex,QVector<int>)));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)),
-                              vdm, QQmlDelegateModel, SLOT(_q_rowsMoved(QModelIndex,int,int,QModelIndex,int)));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(modelReset()),
-                              vdm, QQmlDelegateModel, SLOT(_q_modelReset()));
-            qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
-                              vdm, QQmlDelegateModel, SLOT(_q_layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)));
+            // Other users of the adaptor, such as table models, watch the model themselves.
+            if (vdm) {
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsInserted(QModelIndex,int,int)),
+                                  vdm, QQmlDelegateModel, SLOT(_q_rowsInserted(QModelIndex,int,int)));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),
+                                  vdm,  QQmlDelegateModel, SLOT(_q_rowsRemoved(QModelIndex,int,int)));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)),
+                                  vdm,  QQmlDelegateModel, SLOT(_q_rowsAboutToBeRemoved(QModelIndex,int,int)));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)),
+                                  vdm, QQmlDelegateModel, SLOT(_q_dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)),
+                                  vdm, QQmlDelegateModel, SLOT(_q_rowsMoved(QModelIndex,int,int,QModelIndex,int)));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(modelReset()),
+                                  vdm, QQmlDelegateModel, SLOT(_q_modelReset()));
+                qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
+                                  vdm, QQmlDelegateModel, SLOT(_q_layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)));
+            }
         } else {
             accessors = new VDMObjectDelegateDataType;
         }
@@ -76,6 +76,7 @@ public:
         inline Accessors() {}
         virtual ~Accessors();
         virtual int count(const QQmlAdaptorModel &) const { return 0; }
+        virtual int columnCount(const QQmlAdaptorModel &) const { return 1; }
         virtual void cleanup(QQmlAdaptorModel &, QQmlDelegateModel * = nullptr) const {}
 
         virtual QVariant value(const QQmlAdaptorModel &, int, const QString &) const {
@@ -102,6 +103,9 @@ public:
             return QVariant(); }
         virtual bool canFetchMore(const QQmlAdaptorModel &) const { return false; }
         virtual void fetchMore(QQmlAdaptorModel &) const {}
+        virtual bool canPrefetch(const QQmlAdaptorModel &) const { return false; }
+        virtual void prefetch(QQmlAdaptorModel &, int, int) const {}
+        virtual void trimPrefetched(QQmlAdaptorModel &, int, int) const {}
     };
 
     const Accessors *accessors;
@@ -121,6 +125,7 @@ public:
     inline const QAbstractItemModel *aim() const { return static_cast<const QAbstractItemModel *>(object()); }
 
     inline int count() const { return qMax(0, accessors->count(*this)); }
+    inline int columnCount() const { return qMax(0, accessors->columnCount(*this)); }
     inline QVariant value(int index, const QString &role) const {
         return accessors->value(*this, index, role); }
     inline QQmlDelegateModelItem *createItem(QQmlDelegateModelItemMetaType *metaType, int index) {
@@ -142,6 +147,10 @@ public:
     inline QVariant parentModelIndex() const { return accessors->parentModelIndex(*this); }
     inline bool canFetchMore() const { return accessors->canFetchMore(*this); }
     inline void fetchMore() { return accessors->fetchMore(*this); }
+    inline bool canPrefetch() const { return accessors->canPrefetch(*this); }
+    inline void prefetch(int index, int count) { accessors->prefetch(*this, index, count); }
+    inline void trimPrefetched(int index, int count) { accessors->trimPrefetched(*this, index, count); }
+    inline void clearPrefetched() { accessors->trimPrefetched(*this, 0, 0); }
 
 protected:
     void objectDestroyed(QObject *) override;
@@ -95,9 +95,11 @@ QT_BEGIN_NAMESPACE
     that group.  To avoid the inefficiency of iterating over potentially all ranges when looking
     for a specific index, each time a lookup is done the range and its indexes are cached and the
     next lookup is done relative to this.   This works out to near constant time in most relevant
-    use cases because successive index lookups are most frequently adjacent.  The total number of
-    ranges is often quite small, which helps as well. If there is a need for faster random access
-    then a skip list like index may be an appropriate addition.
+    use cases because successive index lookups are most frequently adjacent.  Lookups further away
+    from the cached range use a balanced tree over the ranges, in which every node holds the
+    number of items in each group below it.  Modifications that affect a few ranges update the
+    tree along the way, while those that walk all ranges anyway rebuild it the next time it is
+    needed.
 
     \sa VisualDataModel
 */
@@ -291,6 +293,10 @@ QQmlListCompositor::QQmlListCompositor()
     , m_defaultFlags(PrependFlag | DefaultFlag)
     , m_removeFlags(AppendFlag | PrependFlag | GroupMask)
     , m_moveId(0)
+    , m_rangeRoot(nullptr)
+    , m_rangeSeed(1)
+    , m_modifying(0)
+    , m_rangeIndexValid(false)
 {
 }
 
@@ -314,7 +320,10 @@ QQmlListCompositor::~QQmlListCompositor()
 inline QQmlListCompositor::Range *QQmlListCompositor::insert(
         Range *before, void *list, int index, int count, uint flags)
 {
-    return new Range(before, list, index, count, flags);
+    Range *range = new Range(before, list, index, count, flags);
+    if (m_rangeIndexValid)
+        indexRange(range);
+    return range;
 }
 
 /*!
@@ -326,6 +335,8 @@ inline QQmlListCompositor::Range *QQmlListCompositor::insert(
 inline QQmlListCompositor::Range *QQmlListCompositor::erase(
         Range *range)
 {
+    if (m_rangeIndexValid)
+        unindexRange(range);
     Range *next = range->next;
     next->previous = range->previous;
     next->previous->next = range->next;
@@ -339,6 +350,8 @@ inline QQmlListCompositor::Range *QQmlListCompositor::erase(
 
 void QQmlListCompositor::setGroupCount(int count)
 {
+    Modification modification(this);
+    m_rangeIndexValid = false;
     m_groupCount = count;
     m_end = iterator(&m_ranges, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -363,7 +376,10 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index < count(group));
-    if (m_cacheIt == m_end) {
+    if (!m_modifying && (m_cacheIt == m_end || qAbs(index - m_cacheIt.index[group]) > 16)) {
+        m_cacheIt = findRange(group, index);
+        m_cacheIt += index - m_cacheIt.index[group];
+    } else if (m_cacheIt == m_end) {
         m_cacheIt = iterator(m_ranges.next, 0, group, m_groupCount);
         m_cacheIt += index;
     } else {
@@ -405,7 +421,10 @@ QQmlListCompositor::insert_iterator QQmlListCompositor::findInsertPosition(Group
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index <= count(group));
     insert_iterator it;
-    if (m_cacheIt == m_end) {
+    if (!m_modifying && (m_cacheIt == m_end || qAbs(index - m_cacheIt.index[group]) > 16)) {
+        it = findRange(group, index);
+        it += index - it.index[group];
+    } else if (m_cacheIt == m_end) {
         it = iterator(m_ranges.next, 0, group, m_groupCount);
         it += index;
     } else {
@@ -418,6 +437,231 @@ QQmlListCompositor::insert_iterator QQmlListCompositor::findInsertPosition(Group
     return it;
 }
 
+/*!
+    \internal
+    Returns an iterator positioned at the start of the range containing the item at \a index
+    in a \a group, or of the range containing the last item of the group if \a index is
+    past its end.
+
+    The ranges are found with a treap which is ordered like the range list, and in which
+    every range holds the total count of itself and the ranges below it in each group.
+    This makes a lookup O(log n), rather than a walk over all of the ranges in between.
+*/
+
+QQmlListCompositor::iterator QQmlListCompositor::findRange(Group group, int index)
+{
+    if (!m_rangeIndexValid)
+        rebuildRangeIndex();
+
+    // During a move the moved items are not part of the tree, so its total may be less
+    // than count(group).
+    const int total = m_rangeRoot ? m_rangeRoot->totals[group] : 0;
+    if (total == 0)
+        return iterator(m_ranges.next, 0, group, m_groupCount);
+    index = qMin(index, total - 1);
+
+    int indexes[MaximumGroupCount] = {};
+    Range *range = m_rangeRoot;
+    for (;;) {
+        if (range->left && index < range->left->totals[group]) {
+            range = range->left;
+            continue;
+        }
+        if (range->left) {
+            index -= range->left->totals[group];
+            for (int i = 0; i < m_groupCount; ++i)
+                indexes[i] += range->left->totals[i];
+        }
+        if (range->inGroup(group) && index < range->count)
+            break;
+        if (range->inGroup(group))
+            index -= range->count;
+        for (int i = 0; i < m_groupCount; ++i) {
+            if (range->inGroup(i))
+                indexes[i] += range->count;
+        }
+        range = range->right;
+        Q_ASSERT(range);
+    }
+
+    iterator it(range, 0, group, m_groupCount);
+    for (int i = 0; i < m_groupCount; ++i)
+        it.index[i] = indexes[i];
+    return it;
+}
+
+/*!
+    \internal
+    Builds the tree of ranges used by findRange() from the range list in O(n).
+*/
+
+void QQmlListCompositor::rebuildRangeIndex()
+{
+    // Build a cartesian tree of the ranges and their priorities. The right spine holds the
+    // ranges which may still get further ranges below them; a range which is removed from it
+    // is complete, so its totals can be computed at that point.
+    QVarLengthArray<Range *, 32> rightSpine;
+    m_rangeRoot = nullptr;
+    for (Range *range = m_ranges.next; range != &m_ranges; range = range->next) {
+        m_rangeSeed = m_rangeSeed * 1103515245 + 12345;
+        range->priority = m_rangeSeed;
+        range->left = nullptr;
+        range->right = nullptr;
+
+        Range *left = nullptr;
+        while (!rightSpine.isEmpty() && rightSpine.last()->priority < range->priority) {
+            left = rightSpine.last();
+            rightSpine.removeLast();
+            updateTotals(left);
+        }
+        range->left = left;
+        if (left)
+            left->parent = range;
+        if (rightSpine.isEmpty()) {
+            range->parent = nullptr;
+            m_rangeRoot = range;
+        } else {
+            range->parent = rightSpine.last();
+            range->parent->right = range;
+        }
+        rightSpine.append(range);
+    }
+    while (!rightSpine.isEmpty()) {
+        updateTotals(rightSpine.last());
+        rightSpine.removeLast();
+    }
+    m_rangeIndexValid = true;
+}
+
+/*!
+    \internal
+    Adds a \a range which has been linked into the range list to the tree of ranges.
+*/
+
+void QQmlListCompositor::indexRange(Range *range)
+{
+    m_rangeSeed = m_rangeSeed * 1103515245 + 12345;
+    range->priority = m_rangeSeed;
+    range->left = nullptr;
+    range->right = nullptr;
+
+    // The tree is ordered like the list, so the new range is either the left child of the next
+    // range, or else the right child of the previous range which then has no right child.
+    if (!m_rangeRoot) {
+        range->parent = nullptr;
+        m_rangeRoot = range;
+    } else if (range->next != &m_ranges && !range->next->left) {
+        range->parent = range->next;
+        range->parent->left = range;
+    } else {
+        Q_ASSERT(!range->previous->right);
+        range->parent = range->previous;
+        range->parent->right = range;
+    }
+    updateTotals(range);
+
+    while (range->parent && range->parent->priority < range->priority)
+        rotateUp(range);
+    for (Range *parent = range->parent; parent; parent = parent->parent)
+        updateTotals(parent);
+}
+
+/*!
+    \internal
+    Removes a \a range from the tree of ranges, before it is removed from the range list.
+*/
+
+void QQmlListCompositor::unindexRange(Range *range)
+{
+    while (range->left || range->right) {
+        rotateUp(!range->right || (range->left && range->left->priority > range->right->priority)
+                ? range->left
+                : range->right);
+    }
+
+    Range *parent = range->parent;
+    if (!parent)
+        m_rangeRoot = nullptr;
+    else if (parent->left == range)
+        parent->left = nullptr;
+    else
+        parent->right = nullptr;
+    range->parent = nullptr;
+
+    for (; parent; parent = parent->parent)
+        updateTotals(parent);
+}
+
+/*!
+    \internal
+    Rotates a \a range above its parent in the tree of ranges.
+*/
+
+void QQmlListCompositor::rotateUp(Range *range)
+{
+    Range *parent = range->parent;
+    Range *grandParent = parent->parent;
+    if (parent->left == range) {
+        parent->left = range->right;
+        if (parent->left)
+            parent->left->parent = parent;
+        range->right = parent;
+    } else {
+        parent->right = range->left;
+        if (parent->right)
+            parent->right->parent = parent;
+        range->left = parent;
+    }
+    parent->parent = range;
+    range->parent = grandParent;
+
+    if (!grandParent)
+        m_rangeRoot = range;
+    else if (grandParent->left == parent)
+        grandParent->left = range;
+    else
+        grandParent->right = range;
+
+    updateTotals(parent);
+    updateTotals(range);
+}
+
+/*!
+    \internal
+    Recomputes the group totals of a \a range from its own count and flags and the totals of
+    its children in the tree of ranges.
+*/
+
+inline void QQmlListCompositor::updateTotals(Range *range)
+{
+    for (int i = 0; i < m_groupCount; ++i) {
+        range->totals[i] = (range->inGroup(i) ? range->count : 0)
+                + (range->left ? range->left->totals[i] : 0)
+                + (range->right ? range->right->totals[i] : 0);
+    }
+}
+
+/*!
+    \internal
+    Updates the tree of ranges after the counts or flags of the ranges from \a first to \a last
+    have been changed in place.
+
+    The modification functions only change ranges between the one before the position they
+    start at and the one they finish at, so those are the only ones which need updating.
+*/
+
+void QQmlListCompositor::refreshRanges(Range *first, Range *last)
+{
+    if (!m_rangeIndexValid)
+        return;
+    for (Range *range = first != &m_ranges ? first : m_ranges.next; range != &m_ranges; range = range->next) {
+        for (Range *node = range; node; node = node->parent)
+            updateTotals(node);
+        if (range == last)
+            break;
+    }
+}
+
 /*!
     Appends a range of \a count indexes starting at \a index from a \a list into a compositor
     with the given \a flags.
@@ -460,6 +704,8 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         iterator before, void *list, int index, int count, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< before << list << index << count << flags)
+    Modification modification(this);
+    Range *first = before->previous;
     if (inserts) {
         inserts->append(Insert(before, count, flags & GroupMask));
     }
@@ -499,6 +745,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
 
     m_end.incrementIndexes(count, flags);
     m_cacheIt = before;
+    refreshRanges(first, *before);
     QT_QML_VERIFY_LISTCOMPOSITOR
     return before;
 }
@@ -528,9 +775,11 @@ void QQmlListCompositor::setFlags(
         iterator from, int count, Group group, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< from << count << flags)
+    Modification modification(this);
     if (!flags || !count)
         return;
 
+    Range *first = from->previous;
     if (from != group) {
         // Skip to the next full range if the start one is not a member of the target group.
         from.incrementIndexes(from->count - from.offset);
@@ -610,6 +859,7 @@ void QQmlListCompositor::setFlags(
         *from = erase(*from)->previous;
     }
     m_cacheIt = from;
+    refreshRanges(first, *from);
     QT_QML_VERIFY_LISTCOMPOSITOR
 }
 
@@ -638,10 +888,12 @@ void QQmlListCompositor::clearFlags(
         iterator from, int count, Group group, uint flags, QVector<Remove> *removes)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< from << count << flags)
+    Modification modification(this);
     if (!flags || !count)
         return;
 
     const bool clearCache = flags & CacheFlag;
+    Range *first = from->previous;
 
     if (from != group) {
         // Skip to the next full range if the start one is not a member of the target group.
@@ -725,6 +977,7 @@ void QQmlListCompositor::clearFlags(
         *from = erase(*from)->previous;
     }
     m_cacheIt = from;
+    refreshRanges(first, *from);
     QT_QML_VERIFY_LISTCOMPOSITOR
 }
 
@@ -780,6 +1033,8 @@ void QQmlListCompositor::move(
 
     // Find the position of the first item to move.
     iterator fromIt = find(fromGroup, from);
+    Range *first = fromIt->previous;
+    Modification modification(this);
 
     if (fromIt != moveGroup) {
         // If the range at the from index doesn't contain items from the move group; skip
@@ -872,12 +1127,22 @@ void QQmlListCompositor::move(
         *fromIt = erase(*fromIt)->previous;
     }
 
+    // The ranges the items were removed from may be removed again while inserting them, so
+    // update the tree for them now.
+    refreshRanges(first, *fromIt);
+
     // Find the destination position of the move.
     insert_iterator toIt = fromIt;
     toIt.setGroup(toGroup);
 
     const int difference = to - toIt.index[toGroup];
-    toIt += difference;
+    if (m_rangeIndexValid && qAbs(difference) > 16) {
+        toIt = findRange(toGroup, to);
+        toIt += to - toIt.index[toGroup];
+    } else {
+        toIt += difference;
+    }
+    first = toIt->previous;
 
     // If the insert position is part way through a range; split it and move the iterator to the
     // start of the second range.
@@ -930,6 +1195,7 @@ void QQmlListCompositor::move(
     }
 
     m_cacheIt = toIt;
+    refreshRanges(first, *toIt);
 
     QT_QML_VERIFY_LISTCOMPOSITOR
 }
@@ -941,6 +1207,9 @@ void QQmlListCompositor::move(
 void QQmlListCompositor::clear()
 {
     QT_QML_TRACE_LISTCOMPOSITOR("")
+    Modification modification(this);
+    m_rangeIndexValid = false;
+    m_rangeRoot = nullptr;
     for (Range *range = m_ranges.next; range != &m_ranges; range = erase(range)) {}
     m_end = iterator(m_ranges.next, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -953,6 +1222,9 @@ void QQmlListCompositor::listItemsInserted(
         const QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << insertions)
+    Modification modification(this);
+    // Every range is visited anyway, so the tree is rebuilt when it is next needed.
+    m_rangeIndexValid = false;
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
             // Skip ranges that don't reference list.
@@ -1076,6 +1348,8 @@ void QQmlListCompositor::listItemsRemoved(
         QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << *removals)
+    Modification modification(this);
+    m_rangeIndexValid = false;
 
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
@@ -99,6 +99,14 @@ public:
         int count = 0;
         uint flags = 0;
 
+        // Links of the order statistic tree QQmlListCompositor indexes its ranges with. The
+        // totals are the counts of the range and of the ranges below it in each group.
+        Range *parent = nullptr;
+        Range *left = nullptr;
+        Range *right = nullptr;
+        uint priority = 0;
+        int totals[MaximumGroupCount] = {};
+
         inline int start() const { return index; }
         inline int end() const { return index + count; }
 
@@ -273,9 +281,36 @@ private:
     int m_removeFlags;
     int m_moveId;
 
+    // The root of a treap over the ranges, ordered as the range list and augmented with the
+    // number of items in each group below every node, so that an item far from m_cacheIt can
+    // be found in O(log n).
+    Range *m_rangeRoot;
+    uint m_rangeSeed;
+    int m_modifying;
+    bool m_rangeIndexValid;
+
+    class Modification
+    {
+    public:
+        Modification(QQmlListCompositor *compositor) : compositor(compositor) {
+            ++compositor->m_modifying; }
+        ~Modification() {
+            --compositor->m_modifying; }
+    private:
+        QQmlListCompositor *compositor;
+    };
+
     inline Range *insert(Range *before, void *list, int index, int count, uint flags);
     inline Range *erase(Range *range);
 
+    iterator findRange(Group group, int index);
+    void rebuildRangeIndex();
+    void indexRange(Range *range);
+    void unindexRange(Range *range);
+    void rotateUp(Range *range);
+    inline void updateTotals(Range *range);
+    void refreshRanges(Range *first, Range *last);
+
     struct MovedFlags
     {
         MovedFlags() {}
@@ -150,6 +150,14 @@ qtConfig(quick-pathview) {
         $$PWD/qquickpathview.cpp
 }
 
+qtConfig(quick-tableview) {
+    HEADERS += \
+        $$PWD/qquicktableview_p.h \
+        $$PWD/qquicktableview_p_p.h
+    SOURCES += \
+        $$PWD/qquicktableview.cpp
+}
+
 qtConfig(quick-positioners) {
     HEADERS += \
         $$PWD/qquickpositioners_p.h \
@@ -185,6 +185,7 @@ public:
     void removeItem(FxViewItem *item);
 
     FxViewItem *newViewItem(int index, QQuickItem *item) override;
+    QQuickItemViewAttached *getAttachedObject(const QObject *object) const override;
     void initializeViewItem(FxViewItem *item) override;
     void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) override;
     void repositionPackageItemAt(QQuickItem *item, int index) override;
@@ -511,7 +512,7 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     FxGridItemSG *item = nullptr;
     bool changed = false;
 
-    QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    const QQmlIncubator::IncubationMode incubationMode = itemIncubationMode(doBuffer);
 
     while (modelIndex < model->count() && rowPos <= fillTo + rowSize()*(columns - colNum)/(columns+1)) {
         qCDebug(lcItemViewDelegateLifecycle) << "refill: append item" << modelIndex << colPos << rowPos;
@@ -530,7 +531,7 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         changed = true;
     }
 
-    if (doBuffer && requestedIndex != -1) // already waiting for an item
+    if (incubationMode == QQmlIncubator::Asynchronous && requestedIndex != -1) // already waiting for an item
         return changed;
 
     // Find first column
@@ -574,10 +575,16 @@ void QQuickGridViewPrivate::removeItem(FxViewItem *item)
         item->releaseAfterTransition = true;
         releasePendingTransition.append(item);
     } else {
-        releaseItem(item);
+        releaseItem(item, reusableFlag());
     }
 }
 
+QQuickItemViewAttached *QQuickGridViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickGridView>(object, false);
+    return static_cast<QQuickItemViewAttached *>(attachedObject);
+}
+
 bool QQuickGridViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal bufferTo)
 {
     FxGridItemSG *item = nullptr;
@@ -1307,6 +1314,78 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlproperty bool QtQuick::GridView::reuseItems
+    \since 5.12
+
+    This property enables you to reuse items that are instantiated
+    from the \l delegate. If set to \c false, any currently
+    pooled items are destroyed.
+
+    When an item scrolls out of the view it is normally destroyed, and a
+    new item is created for the index that scrolls in. With this property
+    set, the item is instead moved to a pool owned by the model and handed
+    out again, with its model data updated, the next time the view needs
+    an item. Only the \c index and model role properties are refreshed;
+    any other state set on the item by the delegate itself is kept.
+    Pooled items that are not picked up again during the next
+    layout pass are destroyed.
+
+    The \l pooled and \l reused attached signals are emitted when an item
+    moves into and out of the pool, and can be used to stop timers or
+    animations, or to reset state the delegate does not derive from its
+    model data.
+
+    Items created from a list of objects, and delegates that use
+    \l Package, are never reused.
+
+    The default value is \c false.
+*/
+
+/*!
+    \qmlproperty real QtQuick::GridView::creationThrottleVelocity
+    \since 5.12
+
+    This property holds the flick velocity, in pixels per second, above
+    which the view stops creating delegates synchronously.
+
+    During a fast flick, most delegates pass through the view within a
+    frame or two. While the view is flicked faster than this velocity,
+    delegates entering the visible area are instead incubated
+    asynchronously, one at a time, using only the time left over in each
+    frame, and the \l cacheBuffer is not filled. Parts of the view may
+    briefly remain empty; they are filled in as soon as the flick slows
+    down below this velocity or stops.
+
+    The default value is \c 0, which disables throttling.
+
+    \sa cacheBuffer, {Flickable::}{maximumFlickVelocity}
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::GridView::pooled()
+    \since 5.12
+
+    This attached signal is emitted after the item has been released by the
+    view and added to the reuse pool. The item is hidden while pooled.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused()
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::GridView::reused()
+    \since 5.12
+
+    This attached signal is emitted after the item has been taken from the
+    reuse pool and assigned a new model index.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled()
+*/
+
 
 /*!
   \qmlproperty model QtQuick::GridView::model
@@ -64,6 +64,9 @@
 #if QT_CONFIG(quick_pathview)
 #include "qquickpathview_p.h"
 #endif
+#if QT_CONFIG(quick_tableview)
+#include "qquicktableview_p.h"
+#endif
 #if QT_CONFIG(quick_viewtransitions)
 #include "qquickitemviewtransition_p.h"
 #endif
@@ -422,6 +425,26 @@ static void qt_quickitems_defineModule(const char *uri, int major, int minor)
     qmlRegisterType<QQuickAnimatedImage, 11>(uri, 2, 11,"AnimatedImage");
 #endif
     qmlRegisterType<QQuickItem, 11>(uri, 2, 11,"Item");
+
+#if QT_CONFIG(quick_itemview)
+    qmlRegisterUncreatableType<QQuickItemView, 12>(uri, 2, 12, itemViewName, itemViewMessage);
+#endif
+#if QT_CONFIG(quick_listview)
+    qmlRegisterType<QQuickListView, 12>(uri, 2, 12, "ListView");
+#endif
+#if QT_CONFIG(quick_gridview)
+    qmlRegisterType<QQuickGridView, 12>(uri, 2, 12, "GridView");
+#endif
+#if QT_CONFIG(quick_pathview)
+    qmlRegisterType<QQuickPathView, 12>(uri, 2, 12, "PathView");
+#endif
+#if QT_CONFIG(quick_tableview)
+    qmlRegisterType<QQuickTableView>(uri, 2, 12, "TableView");
+#endif
+#if QT_CONFIG(quick_repeater)
+    qmlRegisterType<QQuickRepeater, 12>(uri, 2, 12, "Repeater");
+#endif
+    qmlRegisterType<QQuickTextEdit, 12>(uri, 2, 12, "TextEdit");
 }
 
 static void initResources()
@@ -299,6 +299,8 @@ void QQuickItemView::setModel(const QVariant &m)
         disconnect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         disconnect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         disconnect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        disconnect(d->model, SIGNAL(itemPooled(int,QObject*)), this, SLOT(onItemPooled(int,QObject*)));
+        disconnect(d->model, SIGNAL(itemReused(int,QObject*)), this, SLOT(onItemReused(int,QObject*)));
     }
 
     QQmlInstanceModel *oldModel = d->model;
@@ -334,6 +336,8 @@ void QQuickItemView::setModel(const QVariant &m)
         connect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         connect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         connect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        connect(d->model, SIGNAL(itemPooled(int,QObject*)), this, SLOT(onItemPooled(int,QObject*)));
+        connect(d->model, SIGNAL(itemReused(int,QObject*)), this, SLOT(onItemReused(int,QObject*)));
         if (isComponentComplete()) {
             d->updateSectionCriteria();
             d->refill();
@@ -475,6 +479,41 @@ void QQuickItemView::setKeyNavigationEnabled(bool keyNavigationEnabled)
     }
 }
 
+bool QQuickItemView::reuseItems() const
+{
+    Q_D(const QQuickItemView);
+    return d->reuseItems;
+}
+
+void QQuickItemView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickItemView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model)
+        d->model->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
+qreal QQuickItemView::creationThrottleVelocity() const
+{
+    Q_D(const QQuickItemView);
+    return d->creationThrottleVelocity;
+}
+
+void QQuickItemView::setCreationThrottleVelocity(qreal velocity)
+{
+    Q_D(QQuickItemView);
+    velocity = qMax(qreal(0), velocity);
+    if (d->creationThrottleVelocity == velocity)
+        return;
+
+    d->creationThrottleVelocity = velocity;
+    emit creationThrottleVelocityChanged();
+}
+
 int QQuickItemView::cacheBuffer() const
 {
     Q_D(const QQuickItemView);
@@ -1554,7 +1593,7 @@ void QQuickItemView::componentComplete()
 QQuickItemViewPrivate::QQuickItemViewPrivate()
     : itemCount(0)
     , buffer(QML_VIEW_DEFAULTCACHEBUFFER), bufferMode(BufferBefore | BufferAfter)
-    , displayMarginBeginning(0), displayMarginEnd(0)
+    , displayMarginBeginning(0), displayMarginEnd(0), creationThrottleVelocity(0)
     , layoutDirection(Qt::LeftToRight), verticalLayoutDirection(QQuickItemView::TopToBottom)
     , moveReason(Other)
     , visibleIndex(0)
@@ -1573,7 +1612,7 @@ QQuickItemViewPrivate::QQuickItemViewPrivate()
     , inLayout(false), inViewportMoved(false), forceLayout(false), currentIndexCleared(false)
     , haveHighlightRange(false), autoHighlight(true), highlightRangeStartValid(false), highlightRangeEndValid(false)
     , fillCacheBuffer(false), inRequest(false)
-    , runDelayedRemoveTransition(false), delegateValidated(false)
+    , runDelayedRemoveTransition(false), delegateValidated(false), reuseItems(false)
 {
     bufferPause.addAnimationChangeListener(this, QAbstractAnimationJob::Completion);
     bufferPause.setLoopCount(1);
@@ -1797,6 +1836,21 @@ void QQuickItemViewPrivate::animationFinished(QAbstractAnimationJob *)
     q->polish();
 }
 
+/*
+  While the view is being flicked faster than creationThrottleVelocity, items
+  are only on screen for a frame or two. They are then incubated
+  asynchronously, one at a time, within the time the incubation controller
+  leaves in each frame, and the rest of the visible area is filled
+  synchronously once the flick has slowed down.
+*/
+bool QQuickItemViewPrivate::isThrottlingCreation() const
+{
+    if (creationThrottleVelocity <= 0)
+        return false;
+    const AxisData &data = layoutOrientation() == Qt::Vertical ? vData : hData;
+    return data.flicking && qAbs(data.smoothVelocity.value()) > creationThrottleVelocity;
+}
+
 void QQuickItemViewPrivate::refill()
 {
     qreal s = qMax(size(), qreal(0.));
@@ -1831,9 +1885,16 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
         bool added = addVisibleItems(fillFrom, fillTo, bufferFrom, bufferTo, false);
         bool removed = removeNonVisibleItems(bufferFrom, bufferTo);
 
+        // Items are added before they are removed, so a delegate pooled now can
+        // only be picked up by the next pass. Anything older than that is not
+        // needed for the current scroll position and is destroyed.
+        if (reuseItems)
+            model->drainReusableItemsPool(1);
+
         if (requestedIndex == -1 && buffer && bufferMode != NoBuffer) {
-            if (added) {
-                // We've already created a new delegate this frame.
+            if (added || isThrottlingCreation()) {
+                // We've already created a new delegate this frame, or are being
+                // flicked past items too quickly for a buffer to be of any use.
                 // Just schedule a buffer refill.
                 bufferPause.start();
             } else {
@@ -1852,6 +1913,7 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
             updateHeader();
             updateFooter();
             updateViewport();
+            prefetchAroundVisibleItems();
         }
 
         if (prevCount != itemCount)
@@ -1859,6 +1921,27 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
     } while (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges());
 }
 
+/*
+  Lets the model read ahead the data of as many items again as are currently
+  visible or buffered, on either side of them. The range passed includes the
+  visible items so that the model keeps what it has read for them, but it only
+  reads the rows that do not have a delegate yet.
+*/
+void QQuickItemViewPrivate::prefetchAroundVisibleItems()
+{
+    if (visibleItems.isEmpty())
+        return;
+
+    const int first = visibleItems.constFirst()->index;
+    const int last = visibleItems.constLast()->index;
+    if (first < 0 || last < first)
+        return;
+
+    const int span = last - first + 1;
+    const int from = qMax(0, first - span);
+    model->prefetch(from, qMin(itemCount, last + span + 1) - from);
+}
+
 void QQuickItemViewPrivate::regenerate(bool orientationChanged)
 {
     Q_Q(QQuickItemView);
@@ -2435,7 +2518,23 @@ void QQuickItemView::destroyingItem(QObject *object)
     }
 }
 
-bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
+void QQuickItemView::onItemPooled(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickItemView);
+    if (QQuickItemViewAttached *attached = d->getAttachedObject(object))
+        attached->emitPooled();
+}
+
+void QQuickItemView::onItemReused(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickItemView);
+    if (QQuickItemViewAttached *attached = d->getAttachedObject(object))
+        attached->emitReused();
+}
+
+bool QQuickItemViewPrivate::releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     Q_Q(QQuickItemView);
     if (!item || !model)
@@ -2444,12 +2543,15 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
         trackedItem = nullptr;
     item->trackGeometry(false);
 
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item, reusableFlag);
     if (item->item) {
         if (flags == 0) {
             // item was not destroyed, and we no longer reference it.
             QQuickItemPrivate::get(item->item)->setCulled(true);
             unrequestedItems.insert(item->item, model->indexOf(item->item, q));
+        } else if (flags & QQmlInstanceModel::Pooled) {
+            // item is kept by the model for reuse, hide it until then.
+            QQuickItemPrivate::get(item->item)->setCulled(true);
         } else if (flags & QQmlInstanceModel::Destroyed) {
             item->item->setParentItem(nullptr);
         }
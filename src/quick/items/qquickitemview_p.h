@@ -110,6 +110,9 @@ class Q_QUICK_PRIVATE_EXPORT QQuickItemView : public QQuickFlickable
     Q_PROPERTY(qreal preferredHighlightEnd READ preferredHighlightEnd WRITE setPreferredHighlightEnd NOTIFY preferredHighlightEndChanged RESET resetPreferredHighlightEnd)
     Q_PROPERTY(int highlightMoveDuration READ highlightMoveDuration WRITE setHighlightMoveDuration NOTIFY highlightMoveDurationChanged)
 
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 12)
+    Q_PROPERTY(qreal creationThrottleVelocity READ creationThrottleVelocity WRITE setCreationThrottleVelocity NOTIFY creationThrottleVelocityChanged REVISION 12)
+
 public:
     // this holds all layout enum values so they can be referred to by other enums
     // to ensure consistent values - e.g. QML references to GridView.TopToBottom flow
@@ -232,6 +235,12 @@ public:
     Q_INVOKABLE void positionViewAtEnd();
     Q_REVISION(1) Q_INVOKABLE void forceLayout();
 
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
+    qreal creationThrottleVelocity() const;
+    void setCreationThrottleVelocity(qreal velocity);
+
     void setContentX(qreal pos) override;
     void setContentY(qreal pos) override;
     qreal originX() const override;
@@ -276,6 +285,9 @@ Q_SIGNALS:
     void preferredHighlightEndChanged();
     void highlightMoveDurationChanged();
 
+    Q_REVISION(12) void reuseItemsChanged();
+    Q_REVISION(12) void creationThrottleVelocityChanged();
+
 protected:
     void updatePolish() override;
     void componentComplete() override;
@@ -291,6 +303,8 @@ protected Q_SLOTS:
     virtual void initItem(int index, QObject *item);
     void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
     void destroyingItem(QObject *item);
+    void onItemPooled(int modelIndex, QObject *object);
+    void onItemReused(int modelIndex, QObject *object);
     void animStopped();
     void trackedPositionChanged();
 
@@ -381,6 +395,8 @@ public:
 
     void emitAdd() { Q_EMIT add(); }
     void emitRemove() { Q_EMIT remove(); }
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
 
 Q_SIGNALS:
     void viewChanged();
@@ -390,6 +406,9 @@ Q_SIGNALS:
     void add();
     void remove();
 
+    void pooled();
+    void reused();
+
     void sectionChanged();
     void prevSectionChanged();
     void nextSectionChanged();
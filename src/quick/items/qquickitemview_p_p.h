@@ -204,10 +204,12 @@ public:
     void animationFinished(QAbstractAnimationJob *) override;
     void refill();
     void refill(qreal from, qreal to);
+    void prefetchAroundVisibleItems();
     void mirrorChange() override;
 
     FxViewItem *createItem(int modelIndex,QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
-    virtual bool releaseItem(FxViewItem *item);
+    virtual bool releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
+    virtual QQuickItemViewAttached *getAttachedObject(const QObject *) const { return nullptr; }
 
     QQuickItem *createHighlightItem() const;
     QQuickItem *createComponentItem(QQmlComponent *component, qreal zValue, bool createDefault = false) const;
@@ -256,6 +258,15 @@ public:
                 ||runDelayedRemoveTransition;
     }
 
+    QQmlInstanceModel::ReusableFlag reusableFlag() const {
+        return reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable;
+    }
+
+    bool isThrottlingCreation() const;
+    QQmlIncubator::IncubationMode itemIncubationMode(bool doBuffer) const {
+        return doBuffer || isThrottlingCreation() ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    }
+
     void refillOrLayout() {
         if (hasPendingChanges())
             layout();
@@ -285,6 +296,7 @@ public:
     int bufferMode;
     int displayMarginBeginning;
     int displayMarginEnd;
+    qreal creationThrottleVelocity;
     Qt::LayoutDirection layoutDirection;
     QQuickItemView::VerticalLayoutDirection verticalLayoutDirection;
 
@@ -341,6 +353,7 @@ public:
     bool inRequest : 1;
     bool runDelayedRemoveTransition : 1;
     bool delegateValidated : 1;
+    bool reuseItems : 1;
 
 protected:
     virtual Qt::Orientation layoutOrientation() const = 0;
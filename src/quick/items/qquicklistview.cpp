@@ -91,7 +91,8 @@ public:
 
     FxViewItem *newViewItem(int index, QQuickItem *item) override;
     void initializeViewItem(FxViewItem *item) override;
-    bool releaseItem(FxViewItem *item) override;
+    bool releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable) override;
+    QQuickItemViewAttached *getAttachedObject(const QObject *object) const override;
     void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) override;
     void repositionPackageItemAt(QQuickItem *item, int index) override;
     void resetFirstItemPosition(qreal pos = 0.0) override;
@@ -618,7 +619,7 @@ void QQuickListViewPrivate::initializeViewItem(FxViewItem *item)
     }
 }
 
-bool QQuickListViewPrivate::releaseItem(FxViewItem *item)
+bool QQuickListViewPrivate::releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (!item || !model)
         return true;
@@ -626,7 +627,7 @@ bool QQuickListViewPrivate::releaseItem(FxViewItem *item)
     QPointer<QQuickItem> it = item->item;
     QQuickListViewAttached *att = static_cast<QQuickListViewAttached*>(item->attached);
 
-    bool released = QQuickItemViewPrivate::releaseItem(item);
+    bool released = QQuickItemViewPrivate::releaseItem(item, reusableFlag);
     if (released && it && att && att->m_sectionItem) {
         // We hold no more references to this item
         int i = 0;
@@ -674,7 +675,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         }
     }
 
-    QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    const QQmlIncubator::IncubationMode incubationMode = itemIncubationMode(doBuffer);
 
     bool changed = false;
     FxListItemSG *item = nullptr;
@@ -693,7 +694,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         changed = true;
     }
 
-    if (doBuffer && requestedIndex != -1) // already waiting for an item
+    if (incubationMode == QQmlIncubator::Asynchronous && requestedIndex != -1) // already waiting for an item
         return changed;
 
     while (visibleIndex > 0 && visibleIndex <= model->count() && visiblePos > fillFrom) {
@@ -721,10 +722,16 @@ void QQuickListViewPrivate::removeItem(FxViewItem *item)
         releasePendingTransition.append(item);
     } else {
         qCDebug(lcItemViewDelegateLifecycle) << "\treleasing stationary item" << item->index << (QObject *)(item->item);
-        releaseItem(item);
+        releaseItem(item, reusableFlag());
     }
 }
 
+QQuickItemViewAttached *QQuickListViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickListView>(object, false);
+    return static_cast<QQuickItemViewAttached *>(attachedObject);
+}
+
 bool QQuickListViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal bufferTo)
 {
     FxViewItem *item = nullptr;
@@ -1976,6 +1983,78 @@ QQuickListView::~QQuickListView()
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlproperty bool QtQuick::ListView::reuseItems
+    \since 5.12
+
+    This property enables you to reuse items that are instantiated
+    from the \l delegate. If set to \c false, any currently
+    pooled items are destroyed.
+
+    When an item scrolls out of the view it is normally destroyed, and a
+    new item is created for the index that scrolls in. With this property
+    set, the item is instead moved to a pool owned by the model and handed
+    out again, with its model data updated, the next time the view needs
+    an item. Only the \c index and model role properties are refreshed;
+    any other state set on the item by the delegate itself is kept.
+    Pooled items that are not picked up again during the next
+    layout pass are destroyed.
+
+    The \l pooled and \l reused attached signals are emitted when an item
+    moves into and out of the pool, and can be used to stop timers or
+    animations, or to reset state the delegate does not derive from its
+    model data.
+
+    Items created from a list of objects, and delegates that use
+    \l Package, are never reused.
+
+    The default value is \c false.
+*/
+
+/*!
+    \qmlproperty real QtQuick::ListView::creationThrottleVelocity
+    \since 5.12
+
+    This property holds the flick velocity, in pixels per second, above
+    which the view stops creating delegates synchronously.
+
+    During a fast flick, most delegates pass through the view within a
+    frame or two. While the view is flicked faster than this velocity,
+    delegates entering the visible area are instead incubated
+    asynchronously, one at a time, using only the time left over in each
+    frame, and the \l cacheBuffer is not filled. Parts of the view may
+    briefly remain empty; they are filled in as soon as the flick slows
+    down below this velocity or stops.
+
+    The default value is \c 0, which disables throttling.
+
+    \sa cacheBuffer, {Flickable::}{maximumFlickVelocity}
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::ListView::pooled()
+    \since 5.12
+
+    This attached signal is emitted after the item has been released by the
+    view and added to the reuse pool. The item is hidden while pooled.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused()
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::ListView::reused()
+    \since 5.12
+
+    This attached signal is emitted after the item has been taken from the
+    reuse pool and assigned a new model index.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled()
+*/
+
 /*!
     \qmlproperty model QtQuick::ListView::model
     This property holds the model providing data for the list.
@@ -95,7 +95,7 @@ QQuickPathViewPrivate::QQuickPathViewPrivate()
     , stealMouse(false), ownModel(false), interactive(true), haveHighlightRange(true)
     , autoHighlight(true), highlightUp(false), layoutScheduled(false)
     , moving(false), flicking(false), dragging(false), inRequest(false), delegateValidated(false)
-    , inRefill(false)
+    , inRefill(false), reuseItems(false)
     , dragMargin(0), deceleration(100), maximumFlickVelocity(QML_FLICK_DEFAULTMAXVELOCITY)
     , moveOffset(this, &QQuickPathViewPrivate::setAdjustedOffset), flickDuration(0)
     , pathItems(-1), requestedIndex(-1), cacheSize(0), requestedZ(0)
@@ -195,18 +195,23 @@ void QQuickPathView::initItem(int index, QObject *object)
     }
 }
 
-void QQuickPathViewPrivate::releaseItem(QQuickItem *item)
+void QQuickPathViewPrivate::releaseItem(QQuickItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (!item || !model)
         return;
     qCDebug(lcItemViewDelegateLifecycle) << "release" << item;
     QQuickItemPrivate *itemPrivate = QQuickItemPrivate::get(item);
     itemPrivate->removeItemChangeListener(this, QQuickItemPrivate::Geometry);
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item, reusableFlag);
     if (!flags) {
         // item was not destroyed, and we no longer reference it.
         if (QQuickPathViewAttached *att = attached(item))
             att->setOnPath(false);
+    } else if (flags & QQmlInstanceModel::Pooled) {
+        // item is kept by the model for reuse, hide it until then.
+        QQuickItemPrivate::get(item)->setCulled(true);
+        if (QQuickPathViewAttached *att = attached(item))
+            att->setOnPath(false);
     } else if (flags & QQmlInstanceModel::Destroyed) {
         // but we still reference it
         item->setParentItem(nullptr);
@@ -630,6 +635,10 @@ void QQuickPathView::setModel(const QVariant &m)
                              this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                              this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(itemPooled(int,QObject*)),
+                             this, QQuickPathView, SLOT(onItemPooled(int,QObject*)));
+        qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                             this, QQuickPathView, SLOT(onItemReused(int,QObject*)));
         d->clear();
     }
 
@@ -661,6 +670,10 @@ void QQuickPathView::setModel(const QVariant &m)
                           this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                           this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(itemPooled(int,QObject*)),
+                          this, QQuickPathView, SLOT(onItemPooled(int,QObject*)));
+        qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                          this, QQuickPathView, SLOT(onItemReused(int,QObject*)));
         d->modelCount = d->model->count();
     }
     if (isComponentComplete()) {
@@ -1347,6 +1360,76 @@ void QQuickPathView::setCacheItemCount(int i)
     emit cacheItemCountChanged();
 }
 
+/*!
+    \qmlattachedsignal QtQuick::PathView::pooled()
+    \since 5.12
+
+    This attached signal is emitted after the item has been released by the
+    view and added to the reuse pool. The item is hidden while pooled.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused()
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::PathView::reused()
+    \since 5.12
+
+    This attached signal is emitted after the item has been taken from the
+    reuse pool and assigned a new model index.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled()
+*/
+
+/*!
+    \qmlproperty bool QtQuick::PathView::reuseItems
+    \since 5.12
+
+    This property enables you to reuse items that are instantiated
+    from the \l delegate. If set to \c false, any currently
+    pooled items are destroyed.
+
+    When an item scrolls out of the view it is normally destroyed, and a
+    new item is created for the index that scrolls in. With this property
+    set, the item is instead moved to a pool owned by the model and handed
+    out again, with its model data updated, the next time the view needs
+    an item. Only the \c index and model role properties are refreshed;
+    any other state set on the item by the delegate itself is kept.
+    Items that leave the path are pooled before new items are
+    requested, and any that are not picked up again in the same pass
+    are destroyed.
+
+    The \l pooled and \l reused attached signals are emitted when an item
+    moves into and out of the pool, and can be used to stop timers or
+    animations, or to reset state the delegate does not derive from its
+    model data.
+
+    Items created from a list of objects, and delegates that use
+    \l Package, are never reused.
+
+    The default value is \c false.
+*/
+bool QQuickPathView::reuseItems() const
+{
+    Q_D(const QQuickPathView);
+    return d->reuseItems;
+}
+
+void QQuickPathView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickPathView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model)
+        d->model->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
 /*!
     \qmlproperty enumeration QtQuick::PathView::snapMode
 
@@ -1979,7 +2062,7 @@ void QQuickPathView::refill()
                 att->setOnPath(pos < 1.0);
             if (!d->isInBound(pos, d->mappedRange - d->mappedCache, 1.0 + d->mappedCache)) {
                 qCDebug(lcItemViewDelegateLifecycle) << "release" << idx << "@" << pos << ", !isInBound: lower" << (d->mappedRange - d->mappedCache) << "upper" << (1.0 + d->mappedCache);
-                d->releaseItem(item);
+                d->releaseItem(item, d->reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
                 it = d->items.erase(it);
             } else {
                 ++it;
@@ -2165,6 +2248,11 @@ void QQuickPathView::refill()
         d->releaseItem(item);
     d->itemCache.clear();
 
+    // Off-path items are released before new ones are requested, so anything
+    // still pooled at this point is not needed for the current offset.
+    if (d->reuseItems && d->model)
+        d->model->drainReusableItemsPool(0);
+
     d->inRefill = false;
     if (currentChanged)
         emit currentItemChanged();
@@ -2274,6 +2362,26 @@ void QQuickPathView::destroyingItem(QObject *item)
     Q_UNUSED(item);
 }
 
+void QQuickPathView::onItemPooled(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickPathView);
+    if (QQuickItem *item = qmlobject_cast<QQuickItem *>(object)) {
+        if (QQuickPathViewAttached *att = d->attached(item))
+            emit att->pooled();
+    }
+}
+
+void QQuickPathView::onItemReused(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickPathView);
+    if (QQuickItem *item = qmlobject_cast<QQuickItem *>(object)) {
+        if (QQuickPathViewAttached *att = d->attached(item))
+            emit att->reused();
+    }
+}
+
 void QQuickPathView::ticked()
 {
     Q_D(QQuickPathView);
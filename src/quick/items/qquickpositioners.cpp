@@ -66,6 +66,44 @@ void QQuickBasePositionerPrivate::unwatchChanges(QQuickItem* other)
     otherPrivate->removeItemChangeListener(this, watchedChanges);
 }
 
+/*
+  A positioned item that was resized and is still positioned doesn't change the
+  order of the positioned items, so only the items from the first resized one
+  onwards need to be moved. Any other change requires a full positioning pass.
+*/
+void QQuickBasePositionerPrivate::setItemResized(QQuickItem *item, const QRectF &oldGeometry)
+{
+    Q_Q(QQuickBasePositioner);
+    if (positioningDirty && !incrementalPositioning)
+        return;
+
+    const int index = positionedIndexes.value(item, -1);
+    if (index < 0 || transitioner || !item->width() || !item->height()) {
+        setPositioningDirty();
+        return;
+    }
+
+    // The extent across the positioning direction has to be found again from all
+    // items only if the item that may have defined it became smaller.
+    const bool vertical = type == QQuickBasePositioner::Vertical;
+    const qreal oldExtent = vertical ? oldGeometry.width() : oldGeometry.height();
+    const qreal newExtent = vertical ? item->width() : item->height();
+    const qreal extent = vertical
+            ? q->implicitWidth() - q->leftPadding() - q->rightPadding()
+            : q->implicitHeight() - q->topPadding() - q->bottomPadding();
+    if (newExtent < oldExtent && oldExtent >= extent)
+        crossExtentShrunk = true;
+
+    if (!positioningDirty) {
+        positioningDirty = true;
+        incrementalPositioning = true;
+        firstResizedIndex = index;
+        q->polish();
+    } else {
+        firstResizedIndex = qMin(firstResizedIndex, index);
+    }
+}
+
 
 QQuickBasePositioner::PositionedItem::PositionedItem(QQuickItem *i)
     : item(i)
@@ -303,6 +341,23 @@ void QQuickBasePositioner::prePositioning()
 
     d->positioningDirty = false;
     d->doingPositioning = true;
+
+    if (d->incrementalPositioning) {
+        d->incrementalPositioning = false;
+        QSizeF contentSize(0,0);
+        const bool positioned = !d->anchorConflict
+                && d->firstResizedIndex < positionedItems.count()
+                && doIncrementalPositioning(d->firstResizedIndex, &contentSize);
+        d->crossExtentShrunk = false;
+        if (positioned) {
+            d->doingPositioning = false;
+            setImplicitSize(contentSize.width(), contentSize.height());
+            emit positioningComplete();
+            return;
+        }
+    }
+    d->crossExtentShrunk = false;
+
     //Need to order children by creation order modified by stacking order
     QList<QQuickItem *> children = childItems();
 
@@ -313,13 +368,18 @@ void QQuickBasePositioner::prePositioning()
     unpositionedItems.clear();
     int addedIndex = -1;
 
+    QHash<QQuickItem *, int> oldIndexes;
+    oldIndexes.reserve(oldItems.count());
+    for (int ii = 0; ii < oldItems.count(); ++ii)
+        oldIndexes.insert(oldItems.at(ii).item, ii);
+
     for (int ii = 0; ii < children.count(); ++ii) {
         QQuickItem *child = children.at(ii);
         if (QQuickItemPrivate::get(child)->isTransparentForPositioner())
             continue;
         QQuickItemPrivate *childPrivate = QQuickItemPrivate::get(child);
         PositionedItem posItem(child);
-        int wIdx = oldItems.find(posItem);
+        int wIdx = oldIndexes.value(child, -1);
         if (wIdx < 0) {
             d->watchChanges(child);
             posItem.isNew = true;
@@ -399,6 +459,11 @@ void QQuickBasePositioner::prePositioning()
         d->transitioner->resetTargetLists();
     }
 
+    d->positionedIndexes.clear();
+    d->positionedIndexes.reserve(positionedItems.count());
+    for (int ii = 0; ii < positionedItems.count(); ++ii)
+        d->positionedIndexes.insert(positionedItems.at(ii).item, ii);
+
     d->doingPositioning = false;
 
     //Set implicit size to the size of its children
@@ -407,6 +472,19 @@ void QQuickBasePositioner::prePositioning()
     emit positioningComplete();
 }
 
+/*
+  Moves the positioned items from \a fromIndex onwards after they or the items
+  before them were resized, and sets \a contentSize. Returns false if the
+  positioner can't do this without positioning all of its items, which is what
+  the default implementation does.
+*/
+bool QQuickBasePositioner::doIncrementalPositioning(int fromIndex, QSizeF *contentSize)
+{
+    Q_UNUSED(fromIndex);
+    Q_UNUSED(contentSize);
+    return false;
+}
+
 void QQuickBasePositioner::positionItem(qreal x, qreal y, PositionedItem *target)
 {
     if ( target->itemX() != x || target->itemY() != y )
@@ -963,6 +1041,37 @@ void QQuickColumn::doPositioning(QSizeF *contentSize)
     contentSize->setHeight(voffset + bottomPadding());
 }
 
+bool QQuickColumn::doIncrementalPositioning(int fromIndex, QSizeF *contentSize)
+{
+    QQuickBasePositionerPrivate *d = static_cast<QQuickBasePositionerPrivate*>(QQuickBasePositionerPrivate::get(this));
+    const qreal padding = leftPadding() + rightPadding();
+    contentSize->setWidth(implicitWidth());
+    if (d->crossExtentShrunk) {
+        contentSize->setWidth(padding);
+        for (int ii = 0; ii < fromIndex; ++ii)
+            contentSize->setWidth(qMax(contentSize->width(), positionedItems.at(ii).item->width() + padding));
+    }
+
+    qreal voffset = topPadding();
+    if (fromIndex > 0) {
+        const PositionedItem &previous = positionedItems.at(fromIndex - 1);
+        voffset = previous.itemY() + previous.item->height() + spacing();
+    }
+
+    for (int ii = fromIndex; ii < positionedItems.count(); ++ii) {
+        PositionedItem &child = positionedItems[ii];
+        positionItem(child.itemX() + leftPadding() - child.leftPadding, voffset, &child);
+        child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+        contentSize->setWidth(qMax(contentSize->width(), child.item->width() + padding));
+
+        voffset += child.item->height();
+        voffset += spacing();
+    }
+
+    contentSize->setHeight(voffset - spacing() + bottomPadding());
+    return true;
+}
+
 void QQuickColumn::reportConflictingAnchors()
 {
     QQuickBasePositionerPrivate *d = static_cast<QQuickBasePositionerPrivate*>(QQuickBasePositionerPrivate::get(this));
@@ -1251,6 +1360,41 @@ void QQuickRow::doPositioning(QSizeF *contentSize)
     }
 }
 
+bool QQuickRow::doIncrementalPositioning(int fromIndex, QSizeF *contentSize)
+{
+    // Resizing an item in a right-to-left row moves the items before it.
+    QQuickBasePositionerPrivate *d = static_cast<QQuickBasePositionerPrivate* >(QQuickBasePositionerPrivate::get(this));
+    if (!d->isLeftToRight())
+        return false;
+
+    const qreal padding = topPadding() + bottomPadding();
+    contentSize->setHeight(implicitHeight());
+    if (d->crossExtentShrunk) {
+        contentSize->setHeight(padding);
+        for (int ii = 0; ii < fromIndex; ++ii)
+            contentSize->setHeight(qMax(contentSize->height(), positionedItems.at(ii).item->height() + padding));
+    }
+
+    qreal hoffset = leftPadding();
+    if (fromIndex > 0) {
+        const PositionedItem &previous = positionedItems.at(fromIndex - 1);
+        hoffset = previous.itemX() + previous.item->width() + spacing();
+    }
+
+    for (int ii = fromIndex; ii < positionedItems.count(); ++ii) {
+        PositionedItem &child = positionedItems[ii];
+        positionItem(hoffset, child.itemY() + topPadding() - child.topPadding, &child);
+        child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+        contentSize->setHeight(qMax(contentSize->height(), child.item->height() + padding));
+
+        hoffset += child.item->width();
+        hoffset += spacing();
+    }
+
+    contentSize->setWidth(hoffset - spacing() + rightPadding());
+    return true;
+}
+
 void QQuickRow::reportConflictingAnchors()
 {
     QQuickBasePositionerPrivate *d = static_cast<QQuickBasePositionerPrivate*>(QQuickBasePositionerPrivate::get(this));
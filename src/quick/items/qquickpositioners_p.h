@@ -180,6 +180,7 @@ protected Q_SLOTS:
 
 protected:
     virtual void doPositioning(QSizeF *contentSize)=0;
+    virtual bool doIncrementalPositioning(int fromIndex, QSizeF *contentSize);
     virtual void reportConflictingAnchors()=0;
 
     class PositionedItem
@@ -235,6 +236,7 @@ public:
 
 protected:
     void doPositioning(QSizeF *contentSize) override;
+    bool doIncrementalPositioning(int fromIndex, QSizeF *contentSize) override;
     void reportConflictingAnchors() override;
 private:
     Q_DISABLE_COPY(QQuickColumn)
@@ -259,6 +261,7 @@ Q_SIGNALS:
 
 protected:
     void doPositioning(QSizeF *contentSize) override;
+    bool doIncrementalPositioning(int fromIndex, QSizeF *contentSize) override;
     void reportConflictingAnchors() override;
 private:
     Q_DISABLE_COPY(QQuickRow)
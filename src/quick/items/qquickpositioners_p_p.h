@@ -61,6 +61,7 @@ QT_REQUIRE_CONFIG(quick_positioners);
 #include <private/qlazilyallocated_p.h>
 
 #include <QtCore/qobject.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qtimer.h>
 
@@ -90,8 +91,9 @@ public:
 
     QQuickBasePositionerPrivate()
         : spacing(0), type(QQuickBasePositioner::None)
-        , transitioner(0), positioningDirty(false)
-        , doingPositioning(false), anchorConflict(false), layoutDirection(Qt::LeftToRight)
+        , transitioner(0), firstResizedIndex(-1), positioningDirty(false)
+        , doingPositioning(false), anchorConflict(false), incrementalPositioning(false)
+        , crossExtentShrunk(false), layoutDirection(Qt::LeftToRight)
 
     {
     }
@@ -110,15 +112,23 @@ public:
     void unwatchChanges(QQuickItem* other);
     void setPositioningDirty() {
         Q_Q(QQuickBasePositioner);
+        incrementalPositioning = false;
         if (!positioningDirty) {
             positioningDirty = true;
             q->polish();
         }
     }
+    void setItemResized(QQuickItem *item, const QRectF &oldGeometry);
+
+    // Index of each item in positionedItems as of the last full positioning pass
+    QHash<QQuickItem *, int> positionedIndexes;
+    int firstResizedIndex;
 
     bool positioningDirty : 1;
     bool doingPositioning : 1;
     bool anchorConflict : 1;
+    bool incrementalPositioning : 1;
+    bool crossExtentShrunk : 1;
 
     Qt::LayoutDirection layoutDirection;
 
@@ -138,10 +148,10 @@ public:
         setPositioningDirty();
     }
 
-    void itemGeometryChanged(QQuickItem *, QQuickGeometryChange change, const QRectF &) override
+    void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override
     {
         if (change.sizeChange())
-            setPositioningDirty();
+            setItemResized(item, oldGeometry);
     }
 
     void itemVisibilityChanged(QQuickItem *) override
@@ -153,8 +163,10 @@ public:
     {
         Q_Q(QQuickBasePositioner);
         int index = q->positionedItems.find(QQuickBasePositioner::PositionedItem(item));
-        if (index >= 0)
+        if (index >= 0) {
             q->removePositionedItem(&q->positionedItems, index);
+            positionedIndexes.clear();
+        }
     }
 
     static Qt::LayoutDirection getLayoutDirection(const QQuickBasePositioner *positioner)
@@ -44,8 +44,12 @@
 #include <private/qqmllistaccessor_p.h>
 #include <private/qqmlchangeset_p.h>
 #include <private/qqmldelegatemodel_p.h>
+#if QT_CONFIG(quick_positioners)
+#include <private/qquickpositioners_p.h>
+#endif
 
 #include <QtQml/QQmlInfo>
+#include <QtCore/qmath.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,6 +58,8 @@ QQuickRepeaterPrivate::QQuickRepeaterPrivate()
     , ownModel(false)
     , dataSourceIsObject(false)
     , delegateValidated(false)
+    , asynchronous(false)
+    , hasViewport(false)
     , itemCount(0)
 {
     setTransparentForPositioner(true);
@@ -119,6 +125,10 @@ QQuickRepeaterPrivate::~QQuickRepeaterPrivate()
     when they are scrolled into view) or use the \l {Dynamic Object Creation} methods to
     create items as they are required.
 
+    If creating all of the delegate items at once would take too long, set
+    \l asynchronous to create them over several frames instead, and set
+    \l viewport to create only the items that are needed to fill a visible area.
+
     Also, note that Repeater is \l {Item}-based, and can only repeat \l {Item}-derived objects.
     For example, it cannot be used to repeat QtObjects:
     \code
@@ -328,6 +338,106 @@ int QQuickRepeater::count() const
     return 0;
 }
 
+/*!
+    \qmlproperty bool QtQuick::Repeater::asynchronous
+    \since 5.12
+
+    This property holds whether the delegate items are created asynchronously.
+
+    When it is \c false, the default, all of the delegate items are created
+    when the repeater is completed or its model changes. When it is \c true,
+    the items are created by an \l QQmlIncubator in the time that is left
+    over in each frame, so that creating many items doesn't block animations or
+    user input. \l itemAdded() is emitted as each item becomes available, and
+    \l itemAt() returns \c null for the items that have not been created yet.
+*/
+bool QQuickRepeater::asynchronous() const
+{
+    Q_D(const QQuickRepeater);
+    return d->asynchronous;
+}
+
+void QQuickRepeater::setAsynchronous(bool asynchronous)
+{
+    Q_D(QQuickRepeater);
+    if (d->asynchronous == asynchronous)
+        return;
+
+    d->asynchronous = asynchronous;
+    emit asynchronousChanged();
+}
+
+/*!
+    \qmlproperty rect QtQuick::Repeater::viewport
+    \since 5.12
+
+    This property holds the area, in the coordinates of the repeater's parent,
+    that needs to be filled with delegate items.
+
+    When it is set, the repeater creates delegate items in order only until an
+    item starts below or to the right of the viewport. More items are created
+    when the viewport moves further, for example when it is bound to the visible
+    area of a \l Flickable:
+
+    \code
+    Flickable {
+        id: flickable
+        anchors.fill: parent
+        contentHeight: column.height
+        Column {
+            id: column
+            Repeater {
+                model: 1000
+                viewport: Qt.rect(flickable.contentX, flickable.contentY,
+                                  flickable.width, flickable.height)
+                asynchronous: true
+                delegate: Text { text: index }
+            }
+        }
+    }
+    \endcode
+
+    Items that have been created are kept when the viewport moves away from them.
+    \l count always holds the number of items in the model, while \l itemAt()
+    returns \c null for the items that have not been created.
+
+    By default, no viewport is set and all items are created.
+*/
+QRectF QQuickRepeater::viewport() const
+{
+    Q_D(const QQuickRepeater);
+    return d->viewport;
+}
+
+void QQuickRepeater::setViewport(const QRectF &viewport)
+{
+    Q_D(QQuickRepeater);
+    if (d->hasViewport && d->viewport == viewport)
+        return;
+
+    const bool hadViewport = d->hasViewport;
+    d->viewport = viewport;
+    d->hasViewport = true;
+    if (hadViewport)
+        polish();
+    else
+        regenerate();
+    emit viewportChanged();
+}
+
+void QQuickRepeater::resetViewport()
+{
+    Q_D(QQuickRepeater);
+    if (!d->hasViewport)
+        return;
+
+    d->viewport = QRectF();
+    d->hasViewport = false;
+    if (isComponentComplete() && d->model && d->itemCount)
+        d->requestItems();
+    emit viewportChanged();
+}
+
 /*!
     \qmlmethod Item QtQuick::Repeater::itemAt(index)
 
@@ -361,6 +471,21 @@ void QQuickRepeater::itemChange(ItemChange change, const ItemChangeData &value)
     }
 }
 
+void QQuickRepeater::updatePolish()
+{
+    Q_D(QQuickRepeater);
+    if (!d->hasViewport || !d->model || !isComponentComplete())
+        return;
+
+#if QT_CONFIG(quick_positioners)
+    // The items created so far must be in their final positions before they
+    // can be compared with the viewport.
+    if (QQuickBasePositioner *positioner = qobject_cast<QQuickBasePositioner *>(parentItem()))
+        positioner->forceLayout();
+#endif
+    d->requestItemsInViewport();
+}
+
 void QQuickRepeater::clear()
 {
     Q_D(QQuickRepeater);
@@ -398,24 +523,85 @@ void QQuickRepeater::regenerate()
 
     d->itemCount = count();
     d->deletables.resize(d->itemCount);
-    d->requestItems();
+    if (d->hasViewport)
+        polish();
+    else
+        d->requestItems();
+}
+
+QQmlIncubator::IncubationMode QQuickRepeaterPrivate::incubationMode() const
+{
+    return asynchronous ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
 }
 
 void QQuickRepeaterPrivate::requestItems()
 {
     for (int i = 0; i < itemCount; i++) {
-        QObject *object = model->object(i, QQmlIncubator::AsynchronousIfNested);
+        if (deletables.at(i))
+            continue;
+        QObject *object = model->object(i, incubationMode());
         if (object)
             model->release(object);
     }
 }
 
+/*
+  Requests the items that follow the last one created in a row, unless that item
+  already lies beyond the viewport. Once the items created so far show in which
+  direction they are laid out, the size they cover is used to estimate how many
+  more are needed to get past the far edge of the viewport. Until then, as many
+  items are requested as have been created already, so that a distant viewport
+  is reached in a few passes. Requesting an item that is still being incubated
+  has no effect.
+*/
+void QQuickRepeaterPrivate::requestItemsInViewport()
+{
+    Q_Q(QQuickRepeater);
+    int index = 0;
+    QQuickItem *first = deletables.value(0);
+    QQuickItem *last = nullptr;
+    QRectF covered;
+    for (; index < itemCount && deletables.at(index); ++index) {
+        last = deletables.at(index);
+        covered |= QRectF(last->position(), last->size());
+    }
+    if (index == itemCount)
+        return;
+    if (last && (last->y() > viewport.bottom() || last->x() > viewport.right()))
+        return;
+
+    // One more than the estimate, for the first item beyond the edge.
+    int batch = index;
+    if (last && last->y() > first->y() && covered.height() > 0)
+        batch = qCeil(index * (viewport.bottom() - covered.bottom()) / covered.height()) + 1;
+    else if (last && last->x() > first->x() && covered.width() > 0)
+        batch = qCeil(index * (viewport.right() - covered.right()) / covered.width()) + 1;
+    batch = qMax(1, batch);
+
+    bool created = false;
+    for (int remaining = batch; remaining > 0 && index < itemCount; ++index) {
+        if (deletables.at(index))
+            continue;
+        if (QObject *object = model->object(index, incubationMode())) {
+            model->release(object);
+            created = true;
+        }
+        --remaining;
+    }
+
+    // Items created asynchronously schedule the next pass from createdItem().
+    if (created)
+        q->polish();
+}
+
 void QQuickRepeater::createdItem(int index, QObject *)
 {
     Q_D(QQuickRepeater);
     QObject *object = d->model->object(index, QQmlIncubator::AsynchronousIfNested);
     QQuickItem *item = qmlobject_cast<QQuickItem*>(object);
     emit itemAdded(index, item);
+    if (d->hasViewport)
+        polish();
 }
 
 void QQuickRepeater::initItem(int index, QObject *object)
@@ -511,13 +697,18 @@ void QQuickRepeater::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
             int modelIndex = index + i;
             ++d->itemCount;
             d->deletables.insert(modelIndex, nullptr);
-            QObject *object = d->model->object(modelIndex, QQmlIncubator::AsynchronousIfNested);
+            if (d->hasViewport)
+                continue;
+            QObject *object = d->model->object(modelIndex, d->incubationMode());
             if (object)
                 d->model->release(object);
         }
         difference += insert.count;
     }
 
+    if (d->hasViewport)
+        polish();
+
     if (difference != 0)
         emit countChanged();
 }
@@ -69,6 +69,8 @@ class Q_AUTOTEST_EXPORT QQuickRepeater : public QQuickItem
     Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
     Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
     Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY asynchronousChanged REVISION 12)
+    Q_PROPERTY(QRectF viewport READ viewport WRITE setViewport RESET resetViewport NOTIFY viewportChanged REVISION 12)
     Q_CLASSINFO("DefaultProperty", "delegate")
 
 public:
@@ -83,12 +85,21 @@ public:
 
     int count() const;
 
+    bool asynchronous() const;
+    void setAsynchronous(bool asynchronous);
+
+    QRectF viewport() const;
+    void setViewport(const QRectF &viewport);
+    void resetViewport();
+
     Q_INVOKABLE QQuickItem *itemAt(int index) const;
 
 Q_SIGNALS:
     void modelChanged();
     void delegateChanged();
     void countChanged();
+    Q_REVISION(12) void asynchronousChanged();
+    Q_REVISION(12) void viewportChanged();
 
     void itemAdded(int index, QQuickItem *item);
     void itemRemoved(int index, QQuickItem *item);
@@ -100,6 +111,7 @@ private:
 protected:
     void componentComplete() override;
     void itemChange(ItemChange change, const ItemChangeData &value) override;
+    void updatePolish() override;
 
 private Q_SLOTS:
     void createdItem(int index, QObject *item);
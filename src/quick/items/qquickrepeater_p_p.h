@@ -55,6 +55,7 @@
 #include "qquickitem_p.h"
 
 #include <QtCore/qpointer.h>
+#include <QtQml/qqmlincubator.h>
 
 QT_REQUIRE_CONFIG(quick_repeater);
 
@@ -72,6 +73,8 @@ public:
 
 private:
     void requestItems();
+    void requestItemsInViewport();
+    QQmlIncubator::IncubationMode incubationMode() const;
 
     QPointer<QQmlInstanceModel> model;
     QVariant dataSource;
@@ -79,7 +82,10 @@ private:
     bool ownModel : 1;
     bool dataSourceIsObject : 1;
     bool delegateValidated : 1;
+    bool asynchronous : 1;
+    bool hasViewport : 1;
     int itemCount;
+    QRectF viewport;
 
     QVector<QPointer<QQuickItem> > deletables;
 };
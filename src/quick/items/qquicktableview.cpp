@@ -0,0 +1,921 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquicktableview_p_p.h"
+
+#include <QtCore/qloggingcategory.h>
+#include <QtQml/qqmlinfo.h>
+#include <QtQml/private/qqmlchangeset_p.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(lcTableViewDelegateLifecycle, "qt.quick.tableview.lifecycle")
+
+static const qreal MinimumCellSize = 1;
+
+/*!
+    \qmltype TableView
+    \instantiates QQuickTableView
+    \inqmlmodule QtQuick
+    \ingroup qtquick-views
+    \inherits Flickable
+    \since 5.12
+    \brief Provides a table view of items to display data from a model.
+
+    A TableView has a \l model that defines the data to be displayed, and
+    a \l delegate that defines how the data should be displayed. The model
+    is usually a QAbstractItemModel subclass, where each cell of the table
+    is an index in the model's root. A list model, a number or a JavaScript
+    array gives a table with a single column.
+
+    TableView only creates delegate items for the cells that are visible,
+    plus those within the \l cacheBuffer. As the view is flicked, whole rows
+    and columns are added at one edge of the table and removed from the
+    opposite edge, so the cost of flicking does not depend on the size of
+    the model. When \l reuseItems is set, items that are removed are handed
+    out again for the cells that are added, rather than being destroyed and
+    created anew.
+
+    The width of a column is the largest implicit width of the delegate
+    items in that column at the time the column is loaded, and the height
+    of a row is the largest implicit height of its items when it is loaded.
+    The \c row and \c column of a cell are available to the delegate as
+    context properties, in addition to the roles of the model.
+
+    \code
+    TableView {
+        anchors.fill: parent
+        model: tableModel
+        delegate: Text {
+            text: display
+            padding: 4
+        }
+    }
+    \endcode
+
+    \note TableView does not support changes to the structure of the model
+    other than resets: inserting, removing or moving rows or columns makes
+    the view reload all of its cells.
+*/
+
+/*!
+    \qmlattachedproperty TableView QtQuick::TableView::view
+
+    This attached property holds the view that manages the delegate instance.
+    It is attached to each instance of the delegate.
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::TableView::pooled()
+
+    This signal is emitted after an item has been released by the view and
+    added to the reuse pool. The item is hidden while pooled.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused()
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::TableView::reused()
+
+    This signal is emitted after an item has been taken from the reuse
+    pool and assigned a new cell.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled()
+*/
+
+static qreal implicitCellWidth(QQuickItem *item)
+{
+    if (!item)
+        return MinimumCellSize;
+    const qreal width = item->implicitWidth() > 0 ? item->implicitWidth() : item->width();
+    return qMax(width, MinimumCellSize);
+}
+
+static qreal implicitCellHeight(QQuickItem *item)
+{
+    if (!item)
+        return MinimumCellSize;
+    const qreal height = item->implicitHeight() > 0 ? item->implicitHeight() : item->height();
+    return qMax(height, MinimumCellSize);
+}
+
+QQuickTableViewPrivate::QQuickTableViewPrivate()
+    : tableModel(nullptr)
+    , tableRows(0)
+    , tableColumns(0)
+    , rowSpacing(0)
+    , columnSpacing(0)
+    , cacheBuffer(0)
+    , reuseItems(true)
+    , rebuildScheduled(true)
+    , loadingStartCell(false)
+    , delegateValidated(false)
+{
+}
+
+bool QQuickTableViewPrivate::ensureTableModel()
+{
+    Q_Q(QQuickTableView);
+    if (tableModel)
+        return true;
+
+    QQmlContext *context = qmlContext(q);
+    if (!context)
+        return false;
+
+    tableModel = new QQmlTableInstanceModel(context, q);
+    QObject::connect(tableModel, SIGNAL(createdItem(int,QObject*)), q, SLOT(createdItem(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(initItem(int,QObject*)), q, SLOT(initItem(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(modelUpdated(QQmlChangeSet,bool)), q, SLOT(modelUpdated(QQmlChangeSet,bool)));
+    QObject::connect(tableModel, SIGNAL(itemPooled(int,QObject*)), q, SLOT(onItemPooled(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(itemReused(int,QObject*)), q, SLOT(onItemReused(int,QObject*)));
+    tableModel->setModel(modelVariant);
+    return true;
+}
+
+QRectF QQuickTableViewPrivate::viewportRect() const
+{
+    Q_Q(const QQuickTableView);
+    return QRectF(q->contentX(), q->contentY(), q->width(), q->height())
+            .adjusted(-cacheBuffer, -cacheBuffer, cacheBuffer, cacheBuffer);
+}
+
+FxTableItem *QQuickTableViewPrivate::loadedTableItem(int row, int column) const
+{
+    return loadedItems.value(tableModel->indexAt(row, column));
+}
+
+/*
+  Returns the item for the cell, creating it if needed. If the delegate is
+  incubated asynchronously the cell is added to pendingCells and nullptr is
+  returned; the item is then picked up from createdItem(). If the delegate
+  cannot be created the cell gets a placeholder without an item, so that
+  loading the rest of the table is not held up by it.
+*/
+FxTableItem *QQuickTableViewPrivate::requestCell(int row, int column)
+{
+    const int index = tableModel->indexAt(row, column);
+    if (FxTableItem *fxTableItem = loadedItems.value(index))
+        return fxTableItem;
+    if (pendingCells.contains(index))
+        return nullptr;
+
+    QObject *object = tableModel->object(index, QQmlIncubator::AsynchronousIfNested);
+    if (!object && tableModel->incubationStatus(index) == QQmlIncubator::Loading) {
+        pendingCells.insert(index);
+        return nullptr;
+    }
+
+    addLoadedItem(row, column, object);
+    return loadedItems.value(index);
+}
+
+void QQuickTableViewPrivate::addLoadedItem(int row, int column, QObject *object)
+{
+    Q_Q(QQuickTableView);
+    QQuickItem *item = qmlobject_cast<QQuickItem *>(object);
+    if (object && !item) {
+        tableModel->release(object);
+        if (!delegateValidated) {
+            delegateValidated = true;
+            QObject *delegate = q->delegate();
+            qmlWarning(delegate ? delegate : q) << QQuickTableView::tr("Delegate must be of Item type");
+        }
+    }
+
+    qCDebug(lcTableViewDelegateLifecycle) << "load" << row << column << item;
+    if (item) {
+        item->setParentItem(q->contentItem());
+        QQuickItemPrivate::get(item)->setCulled(true);
+    }
+    loadedItems.insert(tableModel->indexAt(row, column), new FxTableItem(item, row, column));
+}
+
+void QQuickTableViewPrivate::releaseItem(FxTableItem *fxTableItem, QQmlInstanceModel::ReusableFlag reusableFlag)
+{
+    if (QQuickItem *item = fxTableItem->item) {
+        qCDebug(lcTableViewDelegateLifecycle) << "release" << fxTableItem->row << fxTableItem->column << item;
+        const QQmlInstanceModel::ReleaseFlags flags = tableModel->release(item, reusableFlag);
+        if (flags & QQmlInstanceModel::Pooled) {
+            // item is kept by the model for reuse, hide it until then.
+            QQuickItemPrivate::get(item)->setCulled(true);
+        } else if (flags & QQmlInstanceModel::Destroyed) {
+            item->setParentItem(nullptr);
+        }
+    }
+    delete fxTableItem;
+}
+
+void QQuickTableViewPrivate::releaseLoadedItems(QQmlInstanceModel::ReusableFlag reusableFlag)
+{
+    for (FxTableItem *fxTableItem : qAsConst(loadedItems))
+        releaseItem(fxTableItem, reusableFlag);
+    loadedItems.clear();
+    loadedTable = QRect();
+    loadedTableRect = QRectF();
+
+    // Cells that are still incubating are destroyed by the model when they
+    // become ready, as nothing will pick them up anymore.
+    pendingCells.clear();
+    loadingEdge = Qt::Edges();
+    loadingStartCell = false;
+}
+
+void QQuickTableViewPrivate::scheduleRebuildTable()
+{
+    Q_Q(QQuickTableView);
+    rebuildScheduled = true;
+    q->polish();
+}
+
+/*
+  Loads the first cell of a new table. The cell is estimated from the
+  content position and the average size of the cells loaded so far, so that
+  flicking far away does not require loading all the cells in between.
+*/
+bool QQuickTableViewPrivate::loadStartCell()
+{
+    Q_Q(QQuickTableView);
+    if (!loadingStartCell) {
+        const qreal cellWidth = averageCellSize.width() + columnSpacing;
+        const qreal cellHeight = averageCellSize.height() + rowSpacing;
+        int column = 0;
+        int row = 0;
+        if (cellWidth > 0)
+            column = qBound(0, int(q->contentX() / cellWidth), columnCount() - 1);
+        if (cellHeight > 0)
+            row = qBound(0, int(q->contentY() / cellHeight), rowCount() - 1);
+        startCell = QPoint(column, row);
+        startCellPosition = QPointF(column * cellWidth, row * cellHeight);
+        loadingStartCell = true;
+    }
+
+    FxTableItem *fxTableItem = requestCell(startCell.y(), startCell.x());
+    if (!fxTableItem)
+        return false;
+
+    const QRectF geometry(startCellPosition, QSizeF(implicitCellWidth(fxTableItem->item),
+                                                    implicitCellHeight(fxTableItem->item)));
+    fxTableItem->setGeometry(geometry);
+    loadedTable = QRect(startCell, QSize(1, 1));
+    loadedTableRect = geometry;
+    loadingStartCell = false;
+    return true;
+}
+
+/*
+  Requests the delegate items for the row or column next to \a edge, and
+  lays them out once all of them are available. Returns false while any of
+  them are still incubating.
+*/
+bool QQuickTableViewPrivate::loadEdge(Qt::Edge edge)
+{
+    loadingEdge = edge;
+
+    bool ready = true;
+    switch (edge) {
+    case Qt::LeftEdge:
+    case Qt::RightEdge: {
+        const int column = edge == Qt::LeftEdge ? loadedTable.left() - 1 : loadedTable.right() + 1;
+        for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row)
+            ready &= requestCell(row, column) != nullptr;
+        break; }
+    case Qt::TopEdge:
+    case Qt::BottomEdge: {
+        const int row = edge == Qt::TopEdge ? loadedTable.top() - 1 : loadedTable.bottom() + 1;
+        for (int column = loadedTable.left(); column <= loadedTable.right(); ++column)
+            ready &= requestCell(row, column) != nullptr;
+        break; }
+    }
+
+    if (!ready)
+        return false;
+
+    layoutEdge(edge);
+    loadingEdge = Qt::Edges();
+    return true;
+}
+
+void QQuickTableViewPrivate::layoutEdge(Qt::Edge edge)
+{
+    switch (edge) {
+    case Qt::LeftEdge:
+    case Qt::RightEdge: {
+        const int column = edge == Qt::LeftEdge ? loadedTable.left() - 1 : loadedTable.right() + 1;
+        const int neighbourColumn = edge == Qt::LeftEdge ? loadedTable.left() : loadedTable.right();
+
+        qreal width = 0;
+        for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row)
+            width = qMax(width, implicitCellWidth(loadedTableItem(row, column)->item));
+
+        const qreal x = edge == Qt::LeftEdge
+                ? loadedTableRect.left() - columnSpacing - width
+                : loadedTableRect.right() + columnSpacing;
+        for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row) {
+            const QRectF neighbour = loadedTableItem(row, neighbourColumn)->geometry();
+            loadedTableItem(row, column)->setGeometry(QRectF(x, neighbour.y(), width, neighbour.height()));
+        }
+
+        if (edge == Qt::LeftEdge) {
+            loadedTable.setLeft(column);
+            loadedTableRect.setLeft(x);
+        } else {
+            loadedTable.setRight(column);
+            loadedTableRect.setRight(x + width);
+        }
+        break; }
+    case Qt::TopEdge:
+    case Qt::BottomEdge: {
+        const int row = edge == Qt::TopEdge ? loadedTable.top() - 1 : loadedTable.bottom() + 1;
+        const int neighbourRow = edge == Qt::TopEdge ? loadedTable.top() : loadedTable.bottom();
+
+        qreal height = 0;
+        for (int column = loadedTable.left(); column <= loadedTable.right(); ++column)
+            height = qMax(height, implicitCellHeight(loadedTableItem(row, column)->item));
+
+        const qreal y = edge == Qt::TopEdge
+                ? loadedTableRect.top() - rowSpacing - height
+                : loadedTableRect.bottom() + rowSpacing;
+        for (int column = loadedTable.left(); column <= loadedTable.right(); ++column) {
+            const QRectF neighbour = loadedTableItem(neighbourRow, column)->geometry();
+            loadedTableItem(row, column)->setGeometry(QRectF(neighbour.x(), y, neighbour.width(), height));
+        }
+
+        if (edge == Qt::TopEdge) {
+            loadedTable.setTop(row);
+            loadedTableRect.setTop(y);
+        } else {
+            loadedTable.setBottom(row);
+            loadedTableRect.setBottom(y + height);
+        }
+        break; }
+    }
+}
+
+void QQuickTableViewPrivate::unloadEdge(Qt::Edge edge)
+{
+    const QQmlInstanceModel::ReusableFlag flag = reusableFlag();
+
+    switch (edge) {
+    case Qt::LeftEdge:
+    case Qt::RightEdge: {
+        const int column = edge == Qt::LeftEdge ? loadedTable.left() : loadedTable.right();
+        for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row)
+            releaseItem(loadedItems.take(tableModel->indexAt(row, column)), flag);
+
+        if (edge == Qt::LeftEdge) {
+            loadedTable.setLeft(column + 1);
+            loadedTableRect.setLeft(loadedTableItem(loadedTable.top(), column + 1)->geometry().left());
+        } else {
+            loadedTable.setRight(column - 1);
+            loadedTableRect.setRight(loadedTableItem(loadedTable.top(), column - 1)->geometry().right());
+        }
+        break; }
+    case Qt::TopEdge:
+    case Qt::BottomEdge: {
+        const int row = edge == Qt::TopEdge ? loadedTable.top() : loadedTable.bottom();
+        for (int column = loadedTable.left(); column <= loadedTable.right(); ++column)
+            releaseItem(loadedItems.take(tableModel->indexAt(row, column)), flag);
+
+        if (edge == Qt::TopEdge) {
+            loadedTable.setTop(row + 1);
+            loadedTableRect.setTop(loadedTableItem(row + 1, loadedTable.left())->geometry().top());
+        } else {
+            loadedTable.setBottom(row - 1);
+            loadedTableRect.setBottom(loadedTableItem(row - 1, loadedTable.left())->geometry().bottom());
+        }
+        break; }
+    }
+}
+
+Qt::Edges QQuickTableViewPrivate::nextEdgeToUnload(const QRectF &viewport) const
+{
+    if (loadedTable.width() > 1) {
+        if (loadedTableItem(loadedTable.top(), loadedTable.left())->geometry().right() < viewport.left())
+            return Qt::LeftEdge;
+        if (loadedTableItem(loadedTable.top(), loadedTable.right())->geometry().left() > viewport.right())
+            return Qt::RightEdge;
+    }
+    if (loadedTable.height() > 1) {
+        if (loadedTableItem(loadedTable.top(), loadedTable.left())->geometry().bottom() < viewport.top())
+            return Qt::TopEdge;
+        if (loadedTableItem(loadedTable.bottom(), loadedTable.left())->geometry().top() > viewport.bottom())
+            return Qt::BottomEdge;
+    }
+    return Qt::Edges();
+}
+
+Qt::Edges QQuickTableViewPrivate::nextEdgeToLoad(const QRectF &viewport) const
+{
+    // Only load an edge if it will be inside the viewport once laid out,
+    // otherwise it would be unloaded again straight away.
+    if (loadedTable.left() > 0 && loadedTableRect.left() - columnSpacing > viewport.left())
+        return Qt::LeftEdge;
+    if (loadedTable.right() < columnCount() - 1 && loadedTableRect.right() + columnSpacing < viewport.right())
+        return Qt::RightEdge;
+    if (loadedTable.top() > 0 && loadedTableRect.top() - rowSpacing > viewport.top())
+        return Qt::TopEdge;
+    if (loadedTable.bottom() < rowCount() - 1 && loadedTableRect.bottom() + rowSpacing < viewport.bottom())
+        return Qt::BottomEdge;
+    return Qt::Edges();
+}
+
+void QQuickTableViewPrivate::updateAverageCellSize()
+{
+    if (loadedTable.isEmpty())
+        return;
+
+    averageCellSize = QSizeF(
+                (loadedTableRect.width() + columnSpacing) / loadedTable.width() - columnSpacing,
+                (loadedTableRect.height() + rowSpacing) / loadedTable.height() - rowSpacing);
+}
+
+/*
+  The position of a start cell is only an estimate. Once the first row or
+  column is loaded, or if the estimate puts the table outside the content
+  item, move the table to where it belongs, and move the content along with
+  it so that nothing changes on screen.
+*/
+void QQuickTableViewPrivate::adjustTablePosition()
+{
+    Q_Q(QQuickTableView);
+    if (loadedTable.isEmpty())
+        return;
+
+    qreal dx = 0;
+    if (loadedTable.left() == 0)
+        dx = -loadedTableRect.left();
+    else if (loadedTableRect.left() <= 0)
+        dx = loadedTable.left() * (averageCellSize.width() + columnSpacing) - loadedTableRect.left();
+
+    qreal dy = 0;
+    if (loadedTable.top() == 0)
+        dy = -loadedTableRect.top();
+    else if (loadedTableRect.top() <= 0)
+        dy = loadedTable.top() * (averageCellSize.height() + rowSpacing) - loadedTableRect.top();
+
+    if (qFuzzyIsNull(dx) && qFuzzyIsNull(dy))
+        return;
+
+    const QPointF delta(dx, dy);
+    for (FxTableItem *fxTableItem : qAsConst(loadedItems))
+        fxTableItem->moveBy(delta);
+    loadedTableRect.translate(delta);
+    startCellPosition += delta;
+
+    updateContentSize();
+    if (!qFuzzyIsNull(dx))
+        q->setContentX(q->contentX() + dx);
+    if (!qFuzzyIsNull(dy))
+        q->setContentY(q->contentY() + dy);
+}
+
+void QQuickTableViewPrivate::updateContentSize()
+{
+    Q_Q(QQuickTableView);
+    qreal width = 0;
+    qreal height = 0;
+    if (!loadedTable.isEmpty()) {
+        // Rows and columns that have not been loaded are assumed to have the average size.
+        width = loadedTableRect.right()
+                + (columnCount() - 1 - loadedTable.right()) * (averageCellSize.width() + columnSpacing);
+        height = loadedTableRect.bottom()
+                + (rowCount() - 1 - loadedTable.bottom()) * (averageCellSize.height() + rowSpacing);
+    }
+
+    if (q->contentWidth() != width)
+        q->setContentWidth(width);
+    if (q->contentHeight() != height)
+        q->setContentHeight(height);
+}
+
+void QQuickTableViewPrivate::updateTableSize()
+{
+    Q_Q(QQuickTableView);
+    const int rows = rowCount();
+    const int columns = columnCount();
+    if (rows != tableRows) {
+        tableRows = rows;
+        emit q->rowsChanged();
+    }
+    if (columns != tableColumns) {
+        tableColumns = columns;
+        emit q->columnsChanged();
+    }
+}
+
+void QQuickTableViewPrivate::updateTable()
+{
+    Q_Q(QQuickTableView);
+    if (!q->isComponentComplete() || !tableModel || !tableModel->delegate())
+        return;
+
+    if (rebuildScheduled) {
+        rebuildScheduled = false;
+        releaseLoadedItems(reusableFlag());
+        updateTableSize();
+    }
+
+    if (rowCount() == 0 || columnCount() == 0) {
+        updateContentSize();
+        return;
+    }
+
+    // Wait for createdItem() to deliver the rest of the cells being loaded.
+    if (!pendingCells.isEmpty())
+        return;
+
+    const QRectF viewport = viewportRect();
+    if (!loadedTable.isEmpty() && !viewport.intersects(loadedTableRect)) {
+        // The content was moved beyond the loaded table; rather than loading
+        // all the rows and columns in between, start over where the view is.
+        qCDebug(lcTableViewDelegateLifecycle) << "rebuild at" << viewport;
+        releaseLoadedItems(reusableFlag());
+    }
+
+    if (loadedTable.isEmpty()) {
+        if (!loadStartCell())
+            return;
+    } else if (loadingEdge) {
+        if (!loadEdge(Qt::Edge(int(loadingEdge))))
+            return;
+    }
+
+    forever {
+        Qt::Edges edge = nextEdgeToUnload(viewport);
+        if (edge) {
+            unloadEdge(Qt::Edge(int(edge)));
+            continue;
+        }
+        edge = nextEdgeToLoad(viewport);
+        if (!edge || !loadEdge(Qt::Edge(int(edge))))
+            break;
+    }
+
+    updateAverageCellSize();
+    adjustTablePosition();
+    updateContentSize();
+
+    // Items are unloaded before new ones are loaded, so anything still
+    // pooled after one more pass is not needed close to the viewport.
+    if (reuseItems)
+        tableModel->drainReusableItemsPool(1);
+}
+
+QQuickTableViewAttached *QQuickTableViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickTableView>(object, false);
+    return static_cast<QQuickTableViewAttached *>(attachedObject);
+}
+
+QQuickTableView::QQuickTableView(QQuickItem *parent)
+    : QQuickFlickable(*(new QQuickTableViewPrivate), parent)
+{
+}
+
+QQuickTableView::~QQuickTableView()
+{
+    Q_D(QQuickTableView);
+    if (d->tableModel) {
+        d->releaseLoadedItems(QQmlInstanceModel::NotReusable);
+        delete d->tableModel;
+        d->tableModel = nullptr;
+    }
+}
+
+/*!
+    \qmlproperty int QtQuick::TableView::rows
+    \readonly
+
+    This property holds the number of rows in the table. This is equal to
+    the number of rows in the model.
+*/
+int QQuickTableView::rows() const
+{
+    Q_D(const QQuickTableView);
+    return d->tableRows;
+}
+
+/*!
+    \qmlproperty int QtQuick::TableView::columns
+    \readonly
+
+    This property holds the number of columns in the table. This is equal
+    to the number of columns in the model, or 1 for models that only have
+    rows.
+*/
+int QQuickTableView::columns() const
+{
+    Q_D(const QQuickTableView);
+    return d->tableColumns;
+}
+
+/*!
+    \qmlproperty real QtQuick::TableView::rowSpacing
+
+    This property holds the spacing between the rows in the table.
+*/
+qreal QQuickTableView::rowSpacing() const
+{
+    Q_D(const QQuickTableView);
+    return d->rowSpacing;
+}
+
+void QQuickTableView::setRowSpacing(qreal spacing)
+{
+    Q_D(QQuickTableView);
+    if (spacing < 0 || d->rowSpacing == spacing)
+        return;
+
+    d->rowSpacing = spacing;
+    d->scheduleRebuildTable();
+    emit rowSpacingChanged();
+}
+
+/*!
+    \qmlproperty real QtQuick::TableView::columnSpacing
+
+    This property holds the spacing between the columns in the table.
+*/
+qreal QQuickTableView::columnSpacing() const
+{
+    Q_D(const QQuickTableView);
+    return d->columnSpacing;
+}
+
+void QQuickTableView::setColumnSpacing(qreal spacing)
+{
+    Q_D(QQuickTableView);
+    if (spacing < 0 || d->columnSpacing == spacing)
+        return;
+
+    d->columnSpacing = spacing;
+    d->scheduleRebuildTable();
+    emit columnSpacingChanged();
+}
+
+/*!
+    \qmlproperty int QtQuick::TableView::cacheBuffer
+
+    This property holds the distance, in pixels, outside the visible area
+    of the view within which delegate items are kept loaded. A larger
+    buffer means that rows and columns are loaded before they are flicked
+    into view, at the expense of additional memory usage.
+
+    The default value is \c 0. Negative values are ignored.
+*/
+int QQuickTableView::cacheBuffer() const
+{
+    Q_D(const QQuickTableView);
+    return d->cacheBuffer;
+}
+
+void QQuickTableView::setCacheBuffer(int newBuffer)
+{
+    Q_D(QQuickTableView);
+    if (newBuffer < 0 || d->cacheBuffer == newBuffer)
+        return;
+
+    d->cacheBuffer = newBuffer;
+    polish();
+    emit cacheBufferChanged();
+}
+
+/*!
+    \qmlproperty model QtQuick::TableView::model
+
+    This property holds the model that provides data for the table.
+
+    \sa {qml-data-models}{Data Models}
+*/
+QVariant QQuickTableView::model() const
+{
+    Q_D(const QQuickTableView);
+    return d->modelVariant;
+}
+
+void QQuickTableView::setModel(const QVariant &newModel)
+{
+    Q_D(QQuickTableView);
+    QVariant model = newModel;
+    if (model.userType() == qMetaTypeId<QJSValue>())
+        model = model.value<QJSValue>().toVariant();
+
+    if (d->modelVariant == model)
+        return;
+
+    d->modelVariant = model;
+    if (d->ensureTableModel()) {
+        // Items created for the old model can't be reused for the new one.
+        d->releaseLoadedItems(QQmlInstanceModel::NotReusable);
+        d->tableModel->setModel(model);
+    }
+    d->scheduleRebuildTable();
+    emit modelChanged();
+}
+
+/*!
+    \qmlproperty Component QtQuick::TableView::delegate
+
+    The delegate provides a template defining each cell item instantiated
+    by the view. The \c row and \c column context properties tell the
+    delegate which cell it belongs to.
+
+    The implicit size of the delegate determines the width of its column
+    and the height of its row.
+*/
+QQmlComponent *QQuickTableView::delegate() const
+{
+    Q_D(const QQuickTableView);
+    return d->tableModel ? d->tableModel->delegate() : nullptr;
+}
+
+void QQuickTableView::setDelegate(QQmlComponent *newDelegate)
+{
+    Q_D(QQuickTableView);
+    if (newDelegate == delegate())
+        return;
+
+    if (d->ensureTableModel()) {
+        d->releaseLoadedItems(QQmlInstanceModel::NotReusable);
+        d->tableModel->setDelegate(newDelegate);
+    }
+    d->delegateValidated = false;
+    d->scheduleRebuildTable();
+    emit delegateChanged();
+}
+
+/*!
+    \qmlproperty bool QtQuick::TableView::reuseItems
+
+    This property holds whether items instantiated from the \l delegate
+    should be reused. If set to \c false, any currently pooled items are
+    destroyed.
+
+    When a row or column is flicked out of the view, its items are moved
+    to a pool instead of being destroyed, and are handed out again for the
+    next cells that need an item. A reused item keeps its state; only the
+    \c row and \c column context properties and the model roles are
+    updated. Use the \l pooled and \l reused attached signals to reset
+    any other state.
+
+    The default value is \c true.
+*/
+bool QQuickTableView::reuseItems() const
+{
+    Q_D(const QQuickTableView);
+    return d->reuseItems;
+}
+
+void QQuickTableView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickTableView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->tableModel)
+        d->tableModel->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
+/*!
+    \qmlmethod QtQuick::TableView::forceLayout()
+
+    Reloads all the cells of the table immediately, so that changes to the
+    implicit size of the delegate items take effect. Normally the view only
+    looks at the size of an item when its row or column is loaded.
+*/
+void QQuickTableView::forceLayout()
+{
+    Q_D(QQuickTableView);
+    d->rebuildScheduled = true;
+    d->updateTable();
+}
+
+QQuickTableViewAttached *QQuickTableView::qmlAttachedProperties(QObject *obj)
+{
+    return new QQuickTableViewAttached(obj);
+}
+
+void QQuickTableView::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickFlickable::geometryChanged(newGeometry, oldGeometry);
+    polish();
+}
+
+void QQuickTableView::viewportMoved(Qt::Orientations orientation)
+{
+    QQuickFlickable::viewportMoved(orientation);
+    polish();
+}
+
+void QQuickTableView::updatePolish()
+{
+    Q_D(QQuickTableView);
+    QQuickFlickable::updatePolish();
+    d->updateTable();
+}
+
+void QQuickTableView::componentComplete()
+{
+    Q_D(QQuickTableView);
+    QQuickFlickable::componentComplete();
+    d->ensureTableModel();
+    d->scheduleRebuildTable();
+}
+
+void QQuickTableView::createdItem(int index, QObject *object)
+{
+    Q_D(QQuickTableView);
+    if (!d->pendingCells.remove(index))
+        return;
+
+    // Take a reference before the model destroys the unclaimed object. The
+    // object is null if the delegate failed, which leaves a placeholder.
+    QObject *cellObject = object ? d->tableModel->object(index, QQmlIncubator::AsynchronousIfNested) : nullptr;
+    d->addLoadedItem(d->tableModel->rowAt(index), d->tableModel->columnAt(index), cellObject);
+    if (d->pendingCells.isEmpty())
+        polish();
+}
+
+void QQuickTableView::initItem(int index, QObject *object)
+{
+    Q_UNUSED(index);
+    if (QQuickItem *item = qmlobject_cast<QQuickItem *>(object)) {
+        item->setParentItem(contentItem());
+        QQuickItemPrivate::get(item)->setCulled(true);
+    }
+    if (QQuickTableViewAttached *attached = static_cast<QQuickTableViewAttached *>(
+                qmlAttachedPropertiesObject<QQuickTableView>(object))) {
+        attached->setView(this);
+    }
+}
+
+void QQuickTableView::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
+{
+    Q_D(QQuickTableView);
+    Q_UNUSED(changeSet);
+    if (reset)
+        d->scheduleRebuildTable();
+}
+
+void QQuickTableView::onItemPooled(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickTableView);
+    if (QQuickTableViewAttached *attached = d->getAttachedObject(object))
+        attached->emitPooled();
+}
+
+void QQuickTableView::onItemReused(int modelIndex, QObject *object)
+{
+    Q_UNUSED(modelIndex);
+    Q_D(QQuickTableView);
+    if (QQuickTableViewAttached *attached = d->getAttachedObject(object))
+        attached->emitReused();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qquicktableview_p.cpp"
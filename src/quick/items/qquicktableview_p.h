@@ -0,0 +1,172 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQUICKTABLEVIEW_P_H
+#define QQUICKTABLEVIEW_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+QT_REQUIRE_CONFIG(quick_tableview);
+
+#include "qquickflickable_p.h"
+#include <qpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQmlChangeSet;
+class QQuickTableViewAttached;
+class QQuickTableViewPrivate;
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableView : public QQuickFlickable
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int rows READ rows NOTIFY rowsChanged)
+    Q_PROPERTY(int columns READ columns NOTIFY columnsChanged)
+    Q_PROPERTY(qreal rowSpacing READ rowSpacing WRITE setRowSpacing NOTIFY rowSpacingChanged)
+    Q_PROPERTY(qreal columnSpacing READ columnSpacing WRITE setColumnSpacing NOTIFY columnSpacingChanged)
+    Q_PROPERTY(int cacheBuffer READ cacheBuffer WRITE setCacheBuffer NOTIFY cacheBufferChanged)
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged)
+
+public:
+    QQuickTableView(QQuickItem *parent = nullptr);
+    ~QQuickTableView();
+
+    int rows() const;
+    int columns() const;
+
+    qreal rowSpacing() const;
+    void setRowSpacing(qreal spacing);
+
+    qreal columnSpacing() const;
+    void setColumnSpacing(qreal spacing);
+
+    int cacheBuffer() const;
+    void setCacheBuffer(int newBuffer);
+
+    QVariant model() const;
+    void setModel(const QVariant &newModel);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *);
+
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
+    Q_INVOKABLE void forceLayout();
+
+    static QQuickTableViewAttached *qmlAttachedProperties(QObject *);
+
+Q_SIGNALS:
+    void rowsChanged();
+    void columnsChanged();
+    void rowSpacingChanged();
+    void columnSpacingChanged();
+    void cacheBufferChanged();
+    void modelChanged();
+    void delegateChanged();
+    void reuseItemsChanged();
+
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void viewportMoved(Qt::Orientations orientation) override;
+    void updatePolish() override;
+    void componentComplete() override;
+
+private Q_SLOTS:
+    void createdItem(int index, QObject *object);
+    void initItem(int index, QObject *object);
+    void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
+    void onItemPooled(int modelIndex, QObject *object);
+    void onItemReused(int modelIndex, QObject *object);
+
+private:
+    Q_DISABLE_COPY(QQuickTableView)
+    Q_DECLARE_PRIVATE(QQuickTableView)
+};
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableViewAttached : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QQuickTableView *view READ view NOTIFY viewChanged)
+
+public:
+    QQuickTableViewAttached(QObject *parent) : QObject(parent) {}
+
+    QQuickTableView *view() const { return m_view; }
+    void setView(QQuickTableView *view) {
+        if (view != m_view) {
+            m_view = view;
+            Q_EMIT viewChanged();
+        }
+    }
+
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
+
+Q_SIGNALS:
+    void viewChanged();
+    void pooled();
+    void reused();
+
+private:
+    QPointer<QQuickTableView> m_view;
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickTableView)
+QML_DECLARE_TYPEINFO(QQuickTableView, QML_HAS_ATTACHED_PROPERTIES)
+
+#endif // QQUICKTABLEVIEW_P_H
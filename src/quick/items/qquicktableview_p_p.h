@@ -0,0 +1,165 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQUICKTABLEVIEW_P_P_H
+#define QQUICKTABLEVIEW_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qquicktableview_p.h"
+
+#include <QtQml/private/qqmltableinstancemodel_p.h>
+#include <QtQuick/private/qquickflickable_p_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class FxTableItem
+{
+public:
+    FxTableItem(QQuickItem *item, int row, int column)
+        : item(item), row(row), column(column) {}
+
+    // A cell without an item is a placeholder for a delegate that could not be
+    // created, which only keeps its geometry so that the table can be laid out.
+    QRectF geometry() const { return item ? QRectF(item->position(), item->size()) : placeholderGeometry; }
+    void setGeometry(const QRectF &rect) {
+        if (!item) {
+            placeholderGeometry = rect;
+            return;
+        }
+        item->setPosition(rect.topLeft());
+        item->setSize(rect.size());
+        // Items are kept hidden from creation until they have been laid out.
+        QQuickItemPrivate::get(item)->setCulled(false);
+    }
+    void moveBy(const QPointF &delta) {
+        if (item)
+            item->setPosition(item->position() + delta);
+        else
+            placeholderGeometry.translate(delta);
+    }
+
+    QPointer<QQuickItem> item;
+    QRectF placeholderGeometry;
+    const int row;
+    const int column;
+};
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableViewPrivate : public QQuickFlickablePrivate
+{
+    Q_DECLARE_PUBLIC(QQuickTableView)
+
+public:
+    QQuickTableViewPrivate();
+
+    static QQuickTableViewPrivate *get(QQuickTableView *q) { return q->d_func(); }
+
+    bool ensureTableModel();
+    int rowCount() const { return tableModel ? tableModel->rows() : 0; }
+    int columnCount() const { return tableModel ? tableModel->columns() : 0; }
+
+    QRectF viewportRect() const;
+
+    FxTableItem *loadedTableItem(int row, int column) const;
+    FxTableItem *requestCell(int row, int column);
+    void addLoadedItem(int row, int column, QObject *object);
+    void releaseItem(FxTableItem *fxTableItem, QQmlInstanceModel::ReusableFlag reusableFlag);
+    void releaseLoadedItems(QQmlInstanceModel::ReusableFlag reusableFlag);
+    QQmlInstanceModel::ReusableFlag reusableFlag() const {
+        return reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable;
+    }
+
+    void updateTable();
+    void scheduleRebuildTable();
+    bool loadStartCell();
+    bool loadEdge(Qt::Edge edge);
+    void layoutEdge(Qt::Edge edge);
+    void unloadEdge(Qt::Edge edge);
+    Qt::Edges nextEdgeToLoad(const QRectF &viewport) const;
+    Qt::Edges nextEdgeToUnload(const QRectF &viewport) const;
+    void adjustTablePosition();
+    void updateAverageCellSize();
+    void updateContentSize();
+    void updateTableSize();
+
+    QQuickTableViewAttached *getAttachedObject(const QObject *object) const;
+
+    QQmlTableInstanceModel *tableModel;
+    QVariant modelVariant;
+
+    // All delegate items held by the view, keyed by QQmlTableInstanceModel::indexAt().
+    QHash<int, FxTableItem *> loadedItems;
+    // The range of rows and columns that is completely loaded and laid out,
+    // and the area it covers in content item coordinates.
+    QRect loadedTable;
+    QRectF loadedTableRect;
+    QSizeF averageCellSize;
+
+    // Cells of the edge (or start cell) being loaded whose delegates
+    // are still incubating.
+    QSet<int> pendingCells;
+    Qt::Edges loadingEdge;
+    QPoint startCell;
+    QPointF startCellPosition;
+
+    int tableRows;
+    int tableColumns;
+    qreal rowSpacing;
+    qreal columnSpacing;
+    int cacheBuffer;
+
+    bool reuseItems : 1;
+    bool rebuildScheduled : 1;
+    bool loadingStartCell : 1;
+    bool delegateValidated : 1;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTABLEVIEW_P_P_H
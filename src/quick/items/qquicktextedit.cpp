@@ -45,6 +45,7 @@
 #include "qquickwindow.h"
 #include "qquicktextnode_p.h"
 #include "qquicktextnodeengine_p.h"
+#include "qquickflickable_p.h"
 
 #include <QtCore/qmath.h>
 #include <QtGui/qguiapplication.h>
@@ -58,6 +59,7 @@
 #include <private/qqmlglobal_p.h>
 #include <private/qqmlproperty_p.h>
 #include <private/qtextengine_p.h>
+#include <private/qtextdocumentlayout_p.h>
 #include <private/qsgadaptationlayer_p.h>
 
 #include "qquicktextdocument.h"
@@ -184,6 +186,12 @@ QQuickTextEdit::QQuickTextEdit(QQuickTextEditPrivate &dd, QQuickItem *parent)
     d->init();
 }
 
+QQuickTextEdit::~QQuickTextEdit()
+{
+    Q_D(QQuickTextEdit);
+    d->removeViewportListeners();
+}
+
 QString QQuickTextEdit::text() const
 {
     Q_D(const QQuickTextEdit);
@@ -564,6 +572,7 @@ void QQuickTextEdit::setFont(const QFont &font)
     }
 
     if (oldFont != d->font) {
+        d->clearBlockLayouts();
         d->document->setDefaultFont(d->font);
         if (d->cursorItem) {
             d->cursorItem->setHeight(QFontMetrics(d->font).height());
@@ -871,6 +880,150 @@ void QQuickTextEditPrivate::setImplicitResizeEnabled(bool enabled)
         extra->implicitResize = true;
 }
 
+/*
+    Returns the document position up to which the document is known to be laid out
+    when the layout is asynchronous, or INT_MAX if all of it is.
+*/
+int QQuickTextEditPrivate::laidOutPosition() const
+{
+    if (!asynchronous)
+        return std::numeric_limits<int>::max();
+    QTextDocumentLayout *layout = qobject_cast<QTextDocumentLayout *>(document->documentLayout());
+    if (!layout)
+        return std::numeric_limits<int>::max();
+    const int status = layout->layoutStatus();
+    if (status >= 100)
+        return std::numeric_limits<int>::max();
+    // layoutStatus() only has a granularity of one percent, so continue from the block it
+    // points to up to the first block that the layout has not reached yet. That block has
+    // no lines, as clearBlockLayouts() discards them whenever the layout starts over.
+    QTextBlock block = document->findBlock(int(qint64(document->characterCount()) * status / 100));
+    while (block.isValid() && block.layout() && block.layout()->lineCount() > 0)
+        block = block.next();
+    return block.isValid() ? block.position() : document->characterCount();
+}
+
+/*
+    Discards the lines of all blocks before a change that makes the document lay out
+    all of its text again, so that the blocks an asynchronous layout has not reached
+    yet can be told apart from those it has.
+*/
+void QQuickTextEditPrivate::clearBlockLayouts()
+{
+    if (!asynchronous)
+        return;
+    for (QTextBlock block = document->begin(); block.isValid(); block = block.next()) {
+        if (QTextLayout *layout = block.layout())
+            layout->clearLayout();
+    }
+}
+
+/*
+    Returns the size of the part of the document that is laid out. Unlike
+    QTextDocument::size(), this does not finish an asynchronous layout.
+*/
+QSizeF QQuickTextEditPrivate::laidOutDocumentSize() const
+{
+    if (asynchronous) {
+        if (QTextDocumentLayout *layout = qobject_cast<QTextDocumentLayout *>(document->documentLayout()))
+            return layout->dynamicDocumentSize();
+    }
+    return document->size();
+}
+
+static const QQuickItemPrivate::ChangeTypes viewportChangeTypes
+    = QQuickItemPrivate::Geometry | QQuickItemPrivate::Parent | QQuickItemPrivate::Destroyed;
+
+/*
+    Finds the Flickable that scrolls the TextEdit, so that text nodes are only
+    created for the part of the document that is near its viewport.
+
+    All ancestors are watched, since moving or reparenting any of them can move the
+    TextEdit into or out of a Flickable, or change which part of it is visible. They
+    include the window's content item, which follows the size of the window and bounds
+    the visible part of a Flickable that does not clip.
+*/
+void QQuickTextEditPrivate::updateFlickable()
+{
+    Q_Q(QQuickTextEdit);
+    removeViewportListeners();
+
+    QQuickFlickable *newFlickable = nullptr;
+    for (QQuickItem *parent = q->parentItem(); parent; parent = parent->parentItem()) {
+        if (!newFlickable)
+            newFlickable = qobject_cast<QQuickFlickable *>(parent);
+        QQuickItemPrivate::get(parent)->addItemChangeListener(this, viewportChangeTypes);
+        viewportAncestors.append(parent);
+    }
+
+    if (newFlickable == flickable) {
+        q->q_viewportChanged();
+        return;
+    }
+
+    // Scrolling and resizing the Flickable are geometry changes of its content item and itself
+    if (flickable)
+        QObject::disconnect(flickable, &QQuickItem::clipChanged, q, &QQuickTextEdit::q_viewportChanged);
+    flickable = newFlickable;
+    if (flickable)
+        QObject::connect(flickable, &QQuickItem::clipChanged, q, &QQuickTextEdit::q_viewportChanged);
+    updateType = UpdatePaintNode;
+    q->update();
+}
+
+void QQuickTextEditPrivate::removeViewportListeners()
+{
+    for (QQuickItem *ancestor : qAsConst(viewportAncestors))
+        QQuickItemPrivate::get(ancestor)->removeItemChangeListener(this, viewportChangeTypes);
+    viewportAncestors.clear();
+}
+
+void QQuickTextEditPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+{
+    Q_Q(QQuickTextEdit);
+    q->q_viewportChanged();
+}
+
+void QQuickTextEditPrivate::itemParentChanged(QQuickItem *, QQuickItem *)
+{
+    updateFlickable();
+}
+
+void QQuickTextEditPrivate::itemDestroyed(QQuickItem *item)
+{
+    viewportAncestors.removeOne(item);
+}
+
+/*
+    Sets \a start and \a end to the range of document positions covered by the blocks
+    that are visible in the viewport of the enclosing Flickable, extended by \a margin
+    viewport heights above and below. Returns false if the TextEdit is not in a Flickable.
+*/
+bool QQuickTextEditPrivate::viewportRange(int *start, int *end, qreal margin) const
+{
+    Q_Q(const QQuickTextEdit);
+    if (!flickable)
+        return false;
+
+    // Content outside of a Flickable that does not clip is visible up to the edges of the window
+    QQuickItem *viewportItem = flickable->clip() || !q->window() ? flickable.data() : q->window()->contentItem();
+    QRectF viewport = q->mapRectFromItem(viewportItem, QRectF(0, 0, viewportItem->width(), viewportItem->height()));
+    viewport.translate(-xoff, -yoff);
+    viewport.adjust(0, -margin * viewport.height(), 0, margin * viewport.height());
+
+    QAbstractTextDocumentLayout *layout = document->documentLayout();
+    const int first = layout->hitTest(QPointF(0, viewport.top()), Qt::FuzzyHit);
+    const int last = layout->hitTest(QPointF(0, viewport.bottom()), Qt::FuzzyHit);
+    *start = first >= 0 ? document->findBlock(first).position() : 0;
+    if (last >= 0) {
+        const QTextBlock lastBlock = document->findBlock(last);
+        *end = lastBlock.position() + lastBlock.length();
+    } else {
+        *end = std::numeric_limits<int>::max();
+    }
+    return true;
+}
+
 QQuickTextEdit::VAlignment QQuickTextEdit::vAlign() const
 {
     Q_D(const QQuickTextEdit);
@@ -924,6 +1077,10 @@ void QQuickTextEdit::setWrapMode(WrapMode mode)
     \qmlproperty int QtQuick::TextEdit::lineCount
 
     Returns the total number of lines in the TextEdit item.
+
+    When \l asynchronous is \c true, lines that have not been laid out yet
+    are not counted as wrapped, so the final line count is only known once
+    the layout has finished.
 */
 int QQuickTextEdit::lineCount() const
 {
@@ -1360,6 +1517,7 @@ void QQuickTextEdit::setTextMargin(qreal margin)
     if (d->textMargin == margin)
         return;
     d->textMargin = margin;
+    d->clearBlockLayouts();
     d->document->setDocumentMargin(d->textMargin);
     emit textMarginChanged(d->textMargin);
 }
@@ -1444,6 +1602,8 @@ void QQuickTextEdit::geometryChanged(const QRectF &newGeometry,
         updateWholeDocument();
         moveCursorDelegate();
     }
+    if (newGeometry.topLeft() != oldGeometry.topLeft() || newGeometry.height() != oldGeometry.height())
+        q_viewportChanged();
     QQuickImplicitSizeItem::geometryChanged(newGeometry, oldGeometry);
 
 }
@@ -1456,6 +1616,7 @@ void QQuickTextEdit::componentComplete()
 {
     Q_D(QQuickTextEdit);
     QQuickImplicitSizeItem::componentComplete();
+    d->updateFlickable();
 
     d->document->setBaseUrl(baseUrl());
 #if QT_CONFIG(texthtmlparser)
@@ -1476,6 +1637,14 @@ void QQuickTextEdit::componentComplete()
         QQuickTextUtil::createCursor(d);
 }
 
+void QQuickTextEdit::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    Q_D(QQuickTextEdit);
+    if (change == ItemParentHasChanged && isComponentComplete())
+        d->updateFlickable();
+    QQuickImplicitSizeItem::itemChange(change, value);
+}
+
 /*!
     \qmlproperty bool QtQuick::TextEdit::selectByKeyboard
     \since 5.1
@@ -2033,22 +2202,59 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
     while (nodeIterator != d->textNodeMap.end() && !nodeIterator->dirty())
         ++nodeIterator;
 
+    // While the document is laid out asynchronously, nodes are only created for the part
+    // that is laid out, and the rest is added as the layout progresses.
+    const int laidOutPos = d->laidOutPosition();
+    const bool layoutPending = laidOutPos != std::numeric_limits<int>::max();
+
+    // In a Flickable, nodes are only created for the blocks within one viewport height of the
+    // visible ones. They are created again when blocks outside of that range become visible.
+    int visibleStart = 0;
+    int visibleEnd = std::numeric_limits<int>::max();
+    int renderStart = 0;
+    int renderEnd = std::numeric_limits<int>::max();
+    if (d->viewportRange(&visibleStart, &visibleEnd))
+        d->viewportRange(&renderStart, &renderEnd, 1);
+
+    const bool layoutProgressed = oldNode && d->firstUnrenderedPos < qMin(visibleEnd, laidOutPos);
+    const bool viewportMoved = oldNode && (d->firstRenderedPosMoved || visibleStart < d->firstRenderedPos
+                                           || (layoutProgressed && d->firstRenderedPos < renderStart));
+    d->firstRenderedPosMoved = false;
+
     QQuickTextNodeEngine engine;
     QQuickTextNodeEngine frameDecorationsEngine;
 
-    if (!oldNode || nodeIterator < d->textNodeMap.end()) {
+    if (!oldNode || nodeIterator < d->textNodeMap.end() || layoutProgressed || viewportMoved) {
 
         if (!oldNode)
             rootNode = new RootNode;
 
         int firstDirtyPos = 0;
-        if (nodeIterator != d->textNodeMap.end()) {
+        if (!oldNode || viewportMoved) {
+            nodeIterator = d->textNodeMap.begin();
+            firstDirtyPos = renderStart;
+            d->firstRenderedPos = renderStart;
+        } else if (layoutProgressed) {
+            const TextNodeIterator firstUnrendered = std::lower_bound(d->textNodeMap.begin(), d->textNodeMap.end(),
+                                                                      TextNode(d->firstUnrenderedPos));
+            if (firstUnrendered < nodeIterator)
+                nodeIterator = firstUnrendered;
+            firstDirtyPos = nodeIterator != d->textNodeMap.end()
+                    ? qMin(nodeIterator->startPos(), d->firstUnrenderedPos)
+                    : d->firstUnrenderedPos;
+        } else if (nodeIterator != d->textNodeMap.end()) {
             firstDirtyPos = nodeIterator->startPos();
+        }
+        if (!oldNode || layoutProgressed || viewportMoved)
+            d->firstUnrenderedPos = std::numeric_limits<int>::max();
+
+        if (nodeIterator != d->textNodeMap.end()) {
             do {
                 rootNode->removeChildNode(nodeIterator->textNode());
                 delete nodeIterator->textNode();
                 nodeIterator = d->textNodeMap.erase(nodeIterator);
-            } while (nodeIterator != d->textNodeMap.end() && nodeIterator->dirty());
+            } while (nodeIterator != d->textNodeMap.end()
+                     && (nodeIterator->dirty() || layoutProgressed || viewportMoved));
         }
 
         // FIXME: the text decorations could probably be handled separately (only updated for affected textFrames)
@@ -2074,11 +2280,18 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
         while (!frames.isEmpty()) {
             QTextFrame *textFrame = frames.takeFirst();
             frames.append(textFrame->childFrames());
-            frameDecorationsEngine.addFrameDecorations(d->document, textFrame);
+            // Frame geometry is only known once the whole document is laid out
+            if (!layoutPending)
+                frameDecorationsEngine.addFrameDecorations(d->document, textFrame);
 
             if (textFrame->lastPosition() < firstDirtyPos
                     || textFrame->firstPosition() >= firstCleanNode.startPos())
                 continue;
+            if (textFrame != d->document->rootFrame()
+                    && (layoutPending || textFrame->firstPosition() >= renderEnd)) {
+                d->firstUnrenderedPos = qMin(d->firstUnrenderedPos, qMax(0, textFrame->firstPosition() - 1));
+                continue;
+            }
             node = d->createTextNode();
             resetEngine(&engine, d->color, d->selectedTextColor, d->selectionColor);
 
@@ -2108,6 +2321,11 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
                     if (block.position() < firstDirtyPos)
                         continue;
 
+                    if (block.position() >= renderEnd || block.position() + block.length() > laidOutPos) {
+                        d->firstUnrenderedPos = qMin(d->firstUnrenderedPos, block.position());
+                        break;
+                    }
+
                     if (!engine.hasContents()) {
                         nodeOffset = d->document->documentLayout()->blockBoundingRect(block).topLeft();
                         updateNodeTransform(node, nodeOffset);
@@ -2136,11 +2354,20 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
         // Now prepend the frame decorations since we want them rendered first, with the text nodes and cursor in front.
         rootNode->prependChildNode(rootNode->frameDecorationsNode);
 
+        // Nodes past the laid out part of the document or the viewport are created when needed.
+        if (d->firstUnrenderedPos != std::numeric_limits<int>::max()) {
+            while (nodeIterator != d->textNodeMap.end()) {
+                rootNode->removeChildNode(nodeIterator->textNode());
+                delete nodeIterator->textNode();
+                nodeIterator = d->textNodeMap.erase(nodeIterator);
+            }
+        }
+
         Q_ASSERT(nodeIterator == d->textNodeMap.end()
                  || (nodeIterator->textNode() == firstCleanNode.textNode()
                      && nodeIterator->startPos() == firstCleanNode.startPos()));
         // Update the position of the subsequent text blocks.
-        if (firstCleanNode.textNode() != nullptr) {
+        if (nodeIterator != d->textNodeMap.end()) {
             QPointF oldOffset = firstCleanNode.textNode()->matrix().map(QPointF(0,0));
             QPointF currentOffset = d->document->documentLayout()->blockBoundingRect(
                         d->document->findBlock(firstCleanNode.startPos())).topLeft();
@@ -2173,7 +2400,18 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
 
 void QQuickTextEdit::updatePolish()
 {
+    Q_D(QQuickTextEdit);
     invalidateFontCaches();
+
+    // Create the nodes for any blocks that have become visible in the viewport
+    int start = 0;
+    int end = std::numeric_limits<int>::max();
+    if (!d->viewportRange(&start, &end))
+        return;
+    if (start < d->firstRenderedPos || qMin(end, d->laidOutPosition()) > d->firstUnrenderedPos) {
+        d->updateType = QQuickTextEditPrivate::UpdatePaintNode;
+        update();
+    }
 }
 
 /*!
@@ -2298,6 +2536,7 @@ void QQuickTextEditPrivate::init()
     qmlobject_connect(document, QQuickTextDocumentWithImageResources, SIGNAL(imagesLoaded()), q, QQuickTextEdit, SLOT(updateSize()));
     QObject::connect(document, &QQuickTextDocumentWithImageResources::contentsChange, q, &QQuickTextEdit::q_contentsChange);
     QObject::connect(document->documentLayout(), &QAbstractTextDocumentLayout::updateBlock, q, &QQuickTextEdit::invalidateBlock);
+    QObject::connect(document->documentLayout(), &QAbstractTextDocumentLayout::documentSizeChanged, q, &QQuickTextEdit::q_documentSizeChanged);
 
     document->setDefaultFont(font);
     document->setDocumentMargin(textMargin);
@@ -2335,6 +2574,16 @@ void QQuickTextEdit::markDirtyNodesForRange(int start, int end, int charDelta)
     if (start == end)
         return;
 
+    if (start < d->firstUnrenderedPos && d->firstUnrenderedPos != std::numeric_limits<int>::max())
+        d->firstUnrenderedPos = qMax(start, d->firstUnrenderedPos + charDelta);
+    if (start < d->firstRenderedPos && (charDelta || end >= d->firstRenderedPos)) {
+        // Changes before the first node move all of the nodes, and may have removed the
+        // blocks they started at, so they are all created again from the new first position
+        d->firstRenderedPos = qMax(start, d->firstRenderedPos + charDelta);
+        d->firstRenderedPosMoved = true;
+        return;
+    }
+
     TextNode dummyNode(start);
 
     const TextNodeIterator textNodeMapBegin = d->textNodeMap.begin();
@@ -2479,7 +2728,10 @@ void QQuickTextEdit::updateSize()
 
     qreal naturalWidth = d->implicitWidth - leftPadding() - rightPadding();
 
-    qreal newWidth = d->document->idealWidth();
+    // The ideal width is only known once all of the document is laid out, so an asynchronous
+    // layout is only possible when the text is wrapped to the width of the item.
+    const bool asynchronousLayout = d->asynchronous && widthValid() && d->wrapMode != NoWrap;
+    qreal newWidth = asynchronousLayout ? d->document->textWidth() : d->document->idealWidth();
     // ### assumes that if the width is set, the text will fill to edges
     // ### (unless wrap is false, then clipping will occur)
     if (widthValid()) {
@@ -2501,19 +2753,26 @@ void QQuickTextEdit::updateSize()
             if (d->inLayout)    // probably the result of a binding loop, but by letting it
                 return;         // get this far we'll get a warning to that effect.
         }
-        if (d->document->textWidth() != width()) {
-            d->document->setTextWidth(width() - leftPadding() - rightPadding());
-            newWidth = d->document->idealWidth();
+        const qreal textWidth = width() - leftPadding() - rightPadding();
+        if (d->document->textWidth() != textWidth) {
+            d->clearBlockLayouts();
+            d->document->setTextWidth(textWidth);
+            newWidth = asynchronousLayout ? textWidth : d->document->idealWidth();
         }
+        if (asynchronousLayout && d->laidOutPosition() == std::numeric_limits<int>::max())
+            newWidth = d->document->idealWidth();
         //### need to confirm cost of always setting these
     } else if (d->wrapMode == NoWrap && d->document->textWidth() != newWidth) {
+        d->clearBlockLayouts();
         d->document->setTextWidth(newWidth); // ### Text does not align if width is not set or the idealWidth exceeds the textWidth (QTextDoc bug)
     } else {
+        d->clearBlockLayouts();
         d->document->setTextWidth(-1);
     }
 
     QFontMetricsF fm(d->font);
-    qreal newHeight = d->document->isEmpty() ? qCeil(fm.height()) : d->document->size().height();
+    const QSizeF documentSize = d->laidOutDocumentSize();
+    qreal newHeight = d->document->isEmpty() ? qCeil(fm.height()) : documentSize.height();
 
     if (d->isImplicitResizeEnabled()) {
         // ### Setting the implicitWidth triggers another updateSize(), and unless there are bindings nothing has changed.
@@ -2523,8 +2782,8 @@ void QQuickTextEdit::updateSize()
             setImplicitHeight(newHeight + topPadding() + bottomPadding());
     }
 
-    d->xoff = leftPadding() + qMax(qreal(0), QQuickTextUtil::alignedX(d->document->size().width(), width() - leftPadding() - rightPadding(), effectiveHAlign()));
-    d->yoff = topPadding() + QQuickTextUtil::alignedY(d->document->size().height(), height() - topPadding() - bottomPadding(), d->vAlign);
+    d->xoff = leftPadding() + qMax(qreal(0), QQuickTextUtil::alignedX(documentSize.width(), width() - leftPadding() - rightPadding(), effectiveHAlign()));
+    d->yoff = topPadding() + QQuickTextUtil::alignedY(documentSize.height(), height() - topPadding() - bottomPadding(), d->vAlign);
     setBaselineOffset(fm.ascent() + d->yoff + d->textMargin);
 
     QSizeF size(newWidth, newHeight);
@@ -2590,7 +2849,9 @@ void QQuickTextEdit::updateTotalLines()
 
     for (QTextBlock it = d->document->begin(); it != d->document->end(); it = it.next()) {
         QTextLayout *layout = it.layout();
-        if (!layout)
+        // Blocks that an asynchronous layout has not reached yet have no lines, and
+        // count as a single line in QTextDocument::lineCount().
+        if (!layout || layout->lineCount() == 0)
             continue;
         subLines += layout->lineCount()-1;
     }
@@ -2639,6 +2900,7 @@ void QQuickTextEditPrivate::updateDefaultTextOption()
     if (oldWrapMode != opt.wrapMode() || oldAlignment != opt.alignment()
         || oldTextDirection != opt.textDirection()
         || oldUseDesignMetrics != opt.useDesignMetrics()) {
+        clearBlockLayouts();
         document->setDefaultTextOption(opt);
     }
 }
@@ -3096,10 +3358,70 @@ void QQuickTextEdit::setTabStopDistance(qreal distance)
         return;
 
     textOptions.setTabStopDistance(distance);
+    d->clearBlockLayouts();
     d->document->setDefaultTextOption(textOptions);
     emit tabStopDistanceChanged(distance);
 }
 
+/*!
+    \qmlproperty bool QtQuick::TextEdit::asynchronous
+    \since 5.12
+
+    This property holds whether the document is laid out asynchronously.
+
+    By default, the whole document is laid out as soon as the text changes,
+    which can block the user interface for a noticeable time when loading
+    large documents. When this property is \c true, only the beginning of the
+    document is laid out immediately, and the rest is laid out in steps
+    while the event loop is idle. The laid out part of the text is shown
+    in the meantime, and \l contentHeight grows as the layout progresses.
+
+    Asynchronous layout is only used when the width of the TextEdit is set
+    and \l wrapMode is not \c TextEdit.NoWrap. Reading \l implicitWidth,
+    the \l contentWidth of unwrapped text, or the geometry of positions that
+    have not been laid out yet finishes the layout immediately.
+
+    The default value is \c false.
+*/
+bool QQuickTextEdit::asynchronous() const
+{
+    Q_D(const QQuickTextEdit);
+    return d->asynchronous;
+}
+
+void QQuickTextEdit::setAsynchronous(bool asynchronous)
+{
+    Q_D(QQuickTextEdit);
+    if (d->asynchronous == asynchronous)
+        return;
+
+    d->asynchronous = asynchronous;
+    updateSize();
+    updateWholeDocument();
+    emit asynchronousChanged();
+}
+
+void QQuickTextEdit::q_documentSizeChanged()
+{
+    Q_D(QQuickTextEdit);
+    if (!d->asynchronous)
+        return;
+
+    updateSize();
+    if (d->firstUnrenderedPos < d->laidOutPosition() && isComponentComplete()) {
+        d->updateType = QQuickTextEditPrivate::UpdatePaintNode;
+        update();
+    }
+}
+
+void QQuickTextEdit::q_viewportChanged()
+{
+    Q_D(QQuickTextEdit);
+    // The visible range is checked once per frame in updatePolish()
+    if (d->flickable && isComponentComplete())
+        polish();
+}
+
 /*!
     \qmlmethod QtQuick::TextEdit::clear()
     \since 5.7
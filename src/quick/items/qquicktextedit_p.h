@@ -112,9 +112,11 @@ class Q_QUICK_PRIVATE_EXPORT QQuickTextEdit : public QQuickImplicitSizeItem
     Q_PROPERTY(qreal bottomPadding READ bottomPadding WRITE setBottomPadding RESET resetBottomPadding NOTIFY bottomPaddingChanged REVISION 6)
     Q_PROPERTY(QString preeditText READ preeditText NOTIFY preeditTextChanged REVISION 7)
     Q_PROPERTY(qreal tabStopDistance READ tabStopDistance WRITE setTabStopDistance NOTIFY tabStopDistanceChanged REVISION 10)
+    Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY asynchronousChanged REVISION 12)
 
 public:
     QQuickTextEdit(QQuickItem *parent=nullptr);
+    ~QQuickTextEdit();
 
     enum HAlignment {
         AlignLeft = Qt::AlignLeft,
@@ -300,6 +302,9 @@ public:
     int tabStopDistance() const;
     void setTabStopDistance(qreal distance);
 
+    bool asynchronous() const;
+    void setAsynchronous(bool asynchronous);
+
 Q_SIGNALS:
     void textChanged();
     Q_REVISION(7) void preeditTextChanged();
@@ -345,6 +350,7 @@ Q_SIGNALS:
     Q_REVISION(6) void rightPaddingChanged();
     Q_REVISION(6) void bottomPaddingChanged();
     Q_REVISION(10) void tabStopDistanceChanged(qreal distance);
+    Q_REVISION(12) void asynchronousChanged();
 
 public Q_SLOTS:
     void selectAll();
@@ -377,6 +383,8 @@ private Q_SLOTS:
     void q_updateAlignment();
     void updateSize();
     void triggerPreprocess();
+    void q_documentSizeChanged();
+    void q_viewportChanged();
 
 private:
     void markDirtyNodesForRange(int start, int end, int charDelta);
@@ -388,6 +396,7 @@ protected:
 
     void geometryChanged(const QRectF &newGeometry,
                          const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
 
     bool event(QEvent *) override;
     void keyPressEvent(QKeyEvent *) override;
@@ -53,10 +53,12 @@
 
 #include "qquicktextedit_p.h"
 #include "qquickimplicitsizeitem_p_p.h"
+#include "qquickitemchangelistener_p.h"
 #include "qquicktextutil_p.h"
 
 #include <QtQml/qqml.h>
 #include <QtCore/qlist.h>
+#include <QtCore/qpointer.h>
 #include <private/qlazilyallocated_p.h>
 
 #include <limits>
@@ -66,9 +68,10 @@ class QTextLayout;
 class QQuickTextDocumentWithImageResources;
 class QQuickTextControl;
 class QQuickTextNode;
+class QQuickFlickable;
 class QQuickTextNodeEngine;
 
-class Q_QUICK_PRIVATE_EXPORT QQuickTextEditPrivate : public QQuickImplicitSizeItemPrivate
+class Q_QUICK_PRIVATE_EXPORT QQuickTextEditPrivate : public QQuickImplicitSizeItemPrivate, public QQuickItemChangeListener
 {
 public:
     Q_DECLARE_PUBLIC(QQuickTextEdit)
@@ -114,6 +117,7 @@ public:
         , textMargin(0.0), xoff(0), yoff(0)
         , font(sourceFont), cursorComponent(nullptr), cursorItem(nullptr), document(nullptr), control(nullptr)
         , quickDocument(nullptr), lastSelectionStart(0), lastSelectionEnd(0), lineCount(0)
+        , firstRenderedPos(0), firstUnrenderedPos(std::numeric_limits<int>::max())
         , hAlign(QQuickTextEdit::AlignLeft), vAlign(QQuickTextEdit::AlignTop)
         , format(QQuickTextEdit::PlainText), wrapMode(QQuickTextEdit::NoWrap)
         , renderType(QQuickTextUtil::textRenderType<QQuickTextEdit>())
@@ -127,7 +131,7 @@ public:
         , focusOnPress(true), persistentSelection(false), requireImplicitWidth(false)
         , selectByMouse(false), canPaste(false), canPasteValid(false), hAlignImplicit(true)
         , textCached(true), inLayout(false), selectByKeyboard(false), selectByKeyboardSet(false)
-        , hadSelection(false)
+        , hadSelection(false), asynchronous(false), firstRenderedPosMoved(false)
     {
     }
 
@@ -164,6 +168,17 @@ public:
     bool isImplicitResizeEnabled() const;
     void setImplicitResizeEnabled(bool enabled);
 
+    int laidOutPosition() const;
+    void clearBlockLayouts();
+    QSizeF laidOutDocumentSize() const;
+    void updateFlickable();
+    void removeViewportListeners();
+    bool viewportRange(int *start, int *end, qreal margin = 0) const;
+
+    void itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &) override;
+    void itemParentChanged(QQuickItem *, QQuickItem *) override;
+    void itemDestroyed(QQuickItem *item) override;
+
     QColor color;
     QColor selectionColor;
     QColor selectedTextColor;
@@ -185,10 +200,14 @@ public:
     QQuickTextControl *control;
     QQuickTextDocument *quickDocument;
     QList<Node> textNodeMap;
+    QPointer<QQuickFlickable> flickable;
+    QList<QQuickItem *> viewportAncestors;
 
     int lastSelectionStart;
     int lastSelectionEnd;
     int lineCount;
+    int firstRenderedPos;
+    int firstUnrenderedPos;
 
     enum UpdateType {
         UpdateNone,
@@ -224,6 +243,8 @@ public:
     bool selectByKeyboard:1;
     bool selectByKeyboardSet:1;
     bool hadSelection : 1;
+    bool asynchronous : 1;
+    bool firstRenderedPosMoved : 1;
 };
 
 QT_END_NAMESPACE
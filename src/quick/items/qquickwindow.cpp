@@ -65,6 +65,7 @@
 #include <QtGui/qmatrix4x4.h>
 #include <QtCore/qvarlengtharray.h>
 #include <QtCore/qabstractanimation.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/QLibraryInfo>
 #include <QtCore/QRunnable>
 #include <QtQml/qqmlincubator.h>
@@ -122,8 +123,8 @@ class QQuickWindowIncubationController : public QObject, public QQmlIncubationCo
     Q_OBJECT
 
 public:
-    QQuickWindowIncubationController(QSGRenderLoop *loop)
-        : m_renderLoop(loop), m_timer(0)
+    QQuickWindowIncubationController(QQuickWindow *window, QSGRenderLoop *loop)
+        : m_window(window), m_renderLoop(loop), m_timer(0)
     {
         // Allow incubation for 1/3 of a frame.
         m_incubation_time = qMax(1, int(1000 / QGuiApplication::primaryScreen()->refreshRate()) / 3);
@@ -155,7 +156,10 @@ public slots:
     void incubate() {
         if (incubatingObjectCount()) {
             if (m_renderLoop->interleaveIncubation()) {
-                incubateFor(m_incubation_time);
+                // Fill the idle part of the frame when the render loop can tell us how
+                // long that is, otherwise fall back to the fixed share of a frame.
+                const int budget = m_renderLoop->incubationTimeBudget(m_window);
+                incubateFor(budget > 0 ? budget : m_incubation_time);
             } else {
                 incubateFor(m_incubation_time * 2);
                 if (incubatingObjectCount())
@@ -174,6 +178,7 @@ protected:
     }
 
 private:
+    QQuickWindow *m_window;
     QSGRenderLoop *m_renderLoop;
     int m_incubation_time;
     int m_timer;
@@ -296,6 +301,11 @@ void QQuickWindowPrivate::polishItems()
     // In the case where polish is called from updatePolish() either directly
     // or indirectly, we use a recursionSafeguard to print a warning to
     // the user.
+    QElapsedTimer polishTimer;
+    const bool recordStatistics = frameStatistics.isEnabled();
+    if (recordStatistics)
+        polishTimer.start();
+
     int recursionSafeguard = INT_MAX;
     while (!itemsToPolish.isEmpty() && --recursionSafeguard > 0) {
         QQuickItem *item = itemsToPolish.takeLast();
@@ -319,6 +329,9 @@ void QQuickWindowPrivate::polishItems()
             updateFocusItemTransform();
     }
 #endif
+
+    if (recordStatistics)
+        lastPolishTime = polishTimer.nsecsElapsed();
 }
 
 /*!
@@ -415,6 +428,11 @@ void QQuickWindowPrivate::syncSceneGraph()
     QML_MEMORY_SCOPE_STRING("SceneGraph");
     Q_Q(QQuickWindow);
 
+    QElapsedTimer syncTimer;
+    const bool recordStatistics = frameStatistics.isEnabled();
+    if (recordStatistics)
+        syncTimer.start();
+
     animationController->beforeNodeSync();
 
     emit q->beforeSynchronizing();
@@ -443,6 +461,13 @@ void QQuickWindowPrivate::syncSceneGraph()
 
     emit q->afterSynchronizing();
     runAndClearJobs(&afterSynchronizingJobs);
+
+    if (recordStatistics) {
+        // The GUI thread is blocked while syncing, so the polish time is safe to take over
+        pendingFrameStatistics.polishTime = lastPolishTime;
+        pendingFrameStatistics.syncTime = syncTimer.nsecsElapsed();
+        lastPolishTime = 0;
+    }
 }
 
 void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
@@ -452,6 +477,11 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
     if (!renderer)
         return;
 
+    QElapsedTimer renderTimer;
+    const bool recordStatistics = frameStatistics.isEnabled();
+    if (recordStatistics)
+        renderTimer.start();
+
     animationController->advance();
     emit q->beforeRendering();
     runAndClearJobs(&beforeRenderingJobs);
@@ -482,6 +512,13 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
     }
     emit q->afterRendering();
     runAndClearJobs(&afterRenderingJobs);
+
+    if (recordStatistics) {
+        pendingFrameStatistics.renderTime = renderTimer.nsecsElapsed();
+        pendingFrameStatistics.renderer = renderer->statistics();
+        frameStatistics.record(pendingFrameStatistics);
+        pendingFrameStatistics = QSGFrameStatistics();
+    }
 }
 
 QQuickWindowPrivate::QQuickWindowPrivate()
@@ -500,6 +537,7 @@ QQuickWindowPrivate::QQuickWindowPrivate()
     , devicePixelRatio(0)
     , context(nullptr)
     , renderer(nullptr)
+    , lastPolishTime(0)
     , windowManager(nullptr)
     , renderControl(nullptr)
     , pointerEventRecursionGuard(0)
@@ -3857,7 +3895,7 @@ QQmlIncubationController *QQuickWindow::incubationController() const
         return nullptr; // TODO: make sure that this is safe
 
     if (!d->incubationController)
-        d->incubationController = new QQuickWindowIncubationController(d->windowManager);
+        d->incubationController = new QQuickWindowIncubationController(const_cast<QQuickWindow *>(this), d->windowManager);
     return d->incubationController;
 }
 
@@ -56,6 +56,7 @@
 #include "qquickevents_p_p.h"
 
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgframestatistics_p.h>
 
 #include <QtCore/qthread.h>
 #include <QtCore/qmutex.h>
@@ -251,6 +252,11 @@ public:
     QSGRenderer *renderer;
     QByteArray customRenderMode; // Default renderer supports "clip", "overdraw", "changes", "batches" and blank.
 
+    // Recorded for every frame once a capacity is set, can be read from any thread
+    QSGFrameStatisticsBuffer frameStatistics;
+    QSGFrameStatistics pendingFrameStatistics;
+    qint64 lastPolishTime;
+
     QSGRenderLoop *windowManager;
     QQuickRenderControl *renderControl;
     QQuickAnimatorController *animationController;
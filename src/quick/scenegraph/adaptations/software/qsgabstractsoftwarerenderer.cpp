@@ -45,6 +45,10 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/qmath.h>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+#include <QtGui/QImage>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -52,18 +56,80 @@ Q_LOGGING_CATEGORY(lc2DRender, "qt.scenegraph.softwarecontext.abstractrenderer")
 
 QT_BEGIN_NAMESPACE
 
+// Bands thinner than this are not worth handing to another thread
+static const int qsg_minimum_tile_height = 32;
+
+// Subtrees with fewer renderable nodes than this are cheap enough to paint
+static const int qsg_subtree_cache_minimum_nodes = 16;
+// Number of frames a subtree has to stay the same before it is cached
+static const int qsg_subtree_cache_stable_frames = 5;
+
+namespace {
+
+class TilePainter : public QRunnable
+{
+public:
+    TilePainter(uchar *bits, const QSize &size, int bytesPerLine, QImage::Format format,
+                qreal devicePixelRatio, const QRect &tile, QPainter::RenderHints renderHints,
+                const QVector<QSGSoftwareRenderableNode *> &nodes, const QVector<QRect> &nodeBounds,
+                const QSGSoftwareRenderableNode *background)
+        : m_bits(bits), m_size(size), m_bytesPerLine(bytesPerLine), m_format(format)
+        , m_devicePixelRatio(devicePixelRatio), m_tile(tile), m_renderHints(renderHints)
+        , m_nodes(nodes), m_nodeBounds(nodeBounds), m_background(background)
+    {
+    }
+
+    void run() override
+    {
+        // The image is created here, so that the painter below is its only user
+        // and does not detach it from the memory of the target.
+        QImage image(m_bits, m_size.width(), m_size.height(), m_bytesPerLine, m_format);
+        image.setDevicePixelRatio(m_devicePixelRatio);
+
+        QPainter painter(&image);
+        painter.setRenderHints(m_renderHints);
+        painter.setWindow(m_tile);
+        for (int i = 0; i < m_nodes.count(); ++i) {
+            const QSGSoftwareRenderableNode *node = m_nodes.at(i);
+            if (m_nodeBounds.at(i).intersects(m_tile))
+                node->paint(&painter, node == m_background);
+        }
+    }
+
+private:
+    uchar *m_bits;
+    QSize m_size;
+    int m_bytesPerLine;
+    QImage::Format m_format;
+    qreal m_devicePixelRatio;
+    QRect m_tile;
+    QPainter::RenderHints m_renderHints;
+    const QVector<QSGSoftwareRenderableNode *> &m_nodes;
+    const QVector<QRect> &m_nodeBounds;
+    const QSGSoftwareRenderableNode *m_background;
+};
+
+}
+
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
     , m_nodeUpdater(new QSGSoftwareRenderableNodeUpdater(this))
+    , m_tilePool(nullptr)
 {
     // Setup special background node
     auto backgroundRenderable = new QSGSoftwareRenderableNode(QSGSoftwareRenderableNode::SimpleRect, m_background);
     addNodeMapping(m_background, backgroundRenderable);
+
+    // In kilobytes, caching of static subtrees is disabled by default
+    m_subtreeCacheBudget = qint64(qEnvironmentVariableIntValue("QSG_SOFTWARE_SUBTREE_CACHE_SIZE")) * 1024;
 }
 
 QSGAbstractSoftwareRenderer::~QSGAbstractSoftwareRenderer()
 {
+    delete m_tilePool;
+    qDeleteAll(m_subtreeCaches);
+
     // Cleanup RenderableNodes
     delete m_background;
 
@@ -72,6 +138,21 @@ QSGAbstractSoftwareRenderer::~QSGAbstractSoftwareRenderer()
     delete m_nodeUpdater;
 }
 
+/*
+  Lets renderNodes() paint the dirty area in bands on QSG_SOFTWARE_RENDER_THREADS
+  threads. The bands are painted in device pixels, so this may only be enabled by
+  renderers whose painter maps the scene to the device without a window transform.
+*/
+void QSGAbstractSoftwareRenderer::enableTiledRendering()
+{
+    // The render thread paints one of the tiles itself
+    const int renderThreads = qEnvironmentVariableIntValue("QSG_SOFTWARE_RENDER_THREADS");
+    if (renderThreads > 1 && !m_tilePool) {
+        m_tilePool = new QThreadPool;
+        m_tilePool->setMaxThreadCount(renderThreads - 1);
+    }
+}
+
 QSGSoftwareRenderableNode *QSGAbstractSoftwareRenderer::renderableNode(QSGNode *node) const
 {
     return m_nodes.value(node, nullptr);
@@ -83,8 +164,183 @@ void QSGAbstractSoftwareRenderer::addNodeMapping(QSGNode *node, QSGSoftwareRende
 }
 
 void QSGAbstractSoftwareRenderer::appendRenderableNode(QSGSoftwareRenderableNode *node)
+{
+    if (!m_subtreeStack.isEmpty()) {
+        SubtreeState &state = m_subtreeStack.last();
+        ++state.nodeCount;
+        state.signature = 31 * state.signature + qHash(node);
+        state.changed |= node->isDirty();
+        state.uncacheable |= node->type() == QSGSoftwareRenderableNode::RenderNode;
+        state.bounds |= node->boundingRectMax();
+    }
+
+    if (m_collectingCache)
+        m_collectingCache->nodes.append(node);
+    else
+        addToRenderList(node);
+}
+
+void QSGAbstractSoftwareRenderer::addToRenderList(QSGSoftwareRenderableNode *node)
 {
     m_renderableNodes.append(node);
+    if (node->isDirty()) {
+        addAffectedRect(node->boundingRectMax());
+        addAffectedRect(node->previousDirtyRegion(true).boundingRect());
+    }
+}
+
+/*
+  Keeps track of the area that the dirty nodes and the regions they leave
+  behind can repaint in this frame. A handful of rectangles is enough to keep
+  a few separate small updates apart; beyond that they are merged into one.
+*/
+void QSGAbstractSoftwareRenderer::addAffectedRect(const QRect &rect)
+{
+    if (rect.isEmpty())
+        return;
+
+    if (m_affectedRects.count() < 8) {
+        m_affectedRects.append(rect);
+    } else {
+        QRect united = rect;
+        for (const QRect &r : qAsConst(m_affectedRects))
+            united |= r;
+        m_affectedRects.clear();
+        m_affectedRects.append(united);
+    }
+}
+
+bool QSGAbstractSoftwareRenderer::isAffected(const QRect &rect) const
+{
+    for (const QRect &r : m_affectedRects) {
+        if (r.intersects(rect))
+            return true;
+    }
+    return false;
+}
+
+/*
+  Called while building the render list for every transform node, that is, for
+  every item. The renderable nodes below it are counted and fingerprinted, so
+  that subtrees which stay the same for a number of frames can be painted from
+  a cached image instead. The outermost of those are represented in the render
+  list by a single node, until anything in them changes.
+*/
+void QSGAbstractSoftwareRenderer::beginSubtree(QSGNode *node)
+{
+    if (!m_subtreeCacheBudget)
+        return;
+
+    SubtreeState state;
+    state.node = node;
+    if (!m_collectingCache) {
+        QSGSoftwareSubtreeCache *cache = m_subtreeCaches.value(node);
+        if (cache && cache->isActive()) {
+            // Hold back the nodes until it is known whether they have changed
+            cache->nodes.clear();
+            m_collectingCache = cache;
+            state.collecting = true;
+        }
+    }
+    m_subtreeStack.append(state);
+}
+
+void QSGAbstractSoftwareRenderer::endSubtree(QSGNode *node)
+{
+    if (!m_subtreeCacheBudget)
+        return;
+
+    SubtreeState state = m_subtreeStack.takeLast();
+    Q_ASSERT(state.node == node);
+    QSGSoftwareSubtreeCache *cache = m_subtreeCaches.value(node);
+
+    if (state.collecting) {
+        m_collectingCache = nullptr;
+        if (!state.changed && !state.uncacheable && state.nodeCount == cache->nodeCount
+                && state.signature == cache->signature && cache->backgroundRect() == backgroundRect()) {
+            addToRenderList(cache->proxy());
+            // Cached subtrees are not nested
+            state.uncacheable = true;
+        } else {
+            for (QSGSoftwareRenderableNode *renderable : qAsConst(cache->nodes))
+                addToRenderList(renderable);
+            deactivateSubtreeCache(cache);
+            updateSubtreeCache(node, cache, state);
+        }
+    } else {
+        updateSubtreeCache(node, cache, state);
+    }
+
+    if (m_subtreeStack.isEmpty()) {
+        m_subtreeCandidates += state.candidates;
+    } else {
+        SubtreeState &parent = m_subtreeStack.last();
+        parent.nodeCount += state.nodeCount;
+        parent.signature = 31 * parent.signature + state.signature;
+        parent.changed |= state.changed;
+        parent.uncacheable |= state.uncacheable;
+        parent.bounds |= state.bounds;
+        parent.candidates += state.candidates;
+    }
+}
+
+void QSGAbstractSoftwareRenderer::updateSubtreeCache(QSGNode *node, QSGSoftwareSubtreeCache *cache, SubtreeState &state)
+{
+    if (state.nodeCount < qsg_subtree_cache_minimum_nodes || state.uncacheable) {
+        if (cache) {
+            deactivateSubtreeCache(cache);
+            m_subtreeCaches.remove(node);
+            delete cache;
+        }
+        return;
+    }
+
+    if (!cache) {
+        cache = new QSGSoftwareSubtreeCache(&m_subtreeCacheStatistics);
+        m_subtreeCaches.insert(node, cache);
+    }
+
+    if (state.changed || state.nodeCount != cache->nodeCount || state.signature != cache->signature) {
+        cache->nodeCount = state.nodeCount;
+        cache->signature = state.signature;
+        cache->stableFrames = 0;
+    } else if (++cache->stableFrames >= qsg_subtree_cache_stable_frames && !m_collectingCache) {
+        // A stable subtree replaces the candidates within it
+        cache->bounds = state.bounds;
+        state.candidates = { node };
+    }
+}
+
+/*
+  Turns the outermost stable subtrees into cached ones, from the next frame on,
+  as far as the memory budget allows.
+*/
+void QSGAbstractSoftwareRenderer::activateSubtreeCaches()
+{
+    const QRect background = backgroundRect();
+    for (QSGNode *node : qAsConst(m_subtreeCandidates)) {
+        QSGSoftwareSubtreeCache *cache = m_subtreeCaches.value(node);
+        if (!cache || cache->isActive())
+            continue;
+
+        const QRect rect = cache->bounds & background;
+        const qint64 bytes = qint64(qCeil(rect.width() * m_devicePixelRatio))
+                * qCeil(rect.height() * m_devicePixelRatio) * 4;
+        if (rect.isEmpty() || m_subtreeCacheSize + bytes > m_subtreeCacheBudget)
+            continue;
+
+        cache->activate(rect, background, bytes);
+        m_subtreeCacheSize += bytes;
+    }
+    m_subtreeCandidates.clear();
+}
+
+void QSGAbstractSoftwareRenderer::deactivateSubtreeCache(QSGSoftwareSubtreeCache *cache)
+{
+    if (!cache->isActive())
+        return;
+    m_subtreeCacheSize -= cache->reservedBytes();
+    cache->deactivate();
 }
 
 void QSGAbstractSoftwareRenderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
@@ -123,6 +379,14 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     if (m_renderableNodes.isEmpty())
         return dirtyRegion;
 
+    m_devicePixelRatio = painter->device()->devicePixelRatioF();
+
+    if (m_tilePool && painter->device()->devType() == QInternal::Image) {
+        const QVector<QRect> tiles = tilesForRenderList(*static_cast<QImage *>(painter->device()));
+        if (tiles.count() > 1)
+            return renderNodesInTiles(painter, tiles);
+    }
+
     auto iterator = m_renderableNodes.begin();
     // First node is the background and needs to painted without blending
     auto backgroundNode = *iterator;
@@ -137,21 +401,143 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+/*
+  Splits the bounding rectangle of everything that is about to be painted into
+  horizontal bands, one for each thread that can paint. Returns no tiles if the
+  image can not be painted in parts.
+*/
+QVector<QRect> QSGAbstractSoftwareRenderer::tilesForRenderList(const QImage &image) const
+{
+    QVector<QRect> tiles;
+
+    // Tile boundaries must fall on whole pixels of the image
+    const qreal dpr = image.devicePixelRatioF();
+    const int scale = qRound(dpr);
+    if (scale < 1 || !qFuzzyCompare(dpr, qreal(scale)) || image.depth() < 8)
+        return tiles;
+
+    QRect area;
+    for (QSGSoftwareRenderableNode *node : qAsConst(m_renderableNodes)) {
+        if (node->needsPainting())
+            area |= node->dirtyRegion().boundingRect();
+    }
+    area &= QRect(0, 0, image.width() / scale, image.height() / scale);
+
+    const int tileCount = qMin(m_tilePool->maxThreadCount() + 1, area.height() / qsg_minimum_tile_height);
+    if (tileCount < 2)
+        return tiles;
+
+    tiles.reserve(tileCount);
+    for (int i = 0; i < tileCount; ++i) {
+        const int top = area.top() + area.height() * i / tileCount;
+        const int bottom = area.top() + area.height() * (i + 1) / tileCount;
+        tiles.append(QRect(area.left(), top, area.width(), bottom - top));
+    }
+    return tiles;
+}
+
+/*
+  Paints the render list into \a tiles of the image \a painter is active on,
+  each on a thread of its own, directly into the memory of the image. This is
+  possible because every renderable node paints with its own clip, transform
+  and opacity.
+
+  Nodes that can only be painted on the render thread, such as text and
+  QSGRenderNodes, are painted with \a painter in between, after waiting for
+  the tiles painted so far, so that the nodes are still blended in order.
+*/
+QRegion QSGAbstractSoftwareRenderer::renderNodesInTiles(QPainter *painter, const QVector<QRect> &tiles)
+{
+    QImage *image = static_cast<QImage *>(painter->device());
+    const qreal dpr = image->devicePixelRatioF();
+    const int scale = qRound(dpr);
+    // The painter has already detached the image, so this does not copy it
+    uchar *bits = const_cast<uchar *>(image->constBits());
+    const int bytesPerLine = image->bytesPerLine();
+    const int bytesPerPixel = image->depth() / 8;
+
+    QRegion dirtyRegion;
+    QSGSoftwareRenderableNode *backgroundNode = m_renderableNodes.first();
+    QVector<QSGSoftwareRenderableNode *> run;
+    QVector<QRect> runBounds;
+
+    auto paintRun = [&]() {
+        if (run.isEmpty())
+            return;
+        for (QSGSoftwareRenderableNode *node : qAsConst(run))
+            runBounds.append(node->dirtyRegion().boundingRect());
+
+        for (int i = tiles.count() - 1; i >= 0; --i) {
+            const QRect &tile = tiles.at(i);
+            TilePainter *tilePainter = new TilePainter(bits + tile.y() * scale * bytesPerLine + tile.x() * scale * bytesPerPixel,
+                                                       tile.size() * scale, bytesPerLine, image->format(), dpr, tile,
+                                                       painter->renderHints(), run, runBounds, backgroundNode);
+            if (i > 0) {
+                m_tilePool->start(tilePainter);
+            } else {
+                tilePainter->run();
+                delete tilePainter;
+            }
+        }
+        m_tilePool->waitForDone();
+
+        for (QSGSoftwareRenderableNode *node : qAsConst(run))
+            dirtyRegion += node->markPainted();
+        run.clear();
+        runBounds.clear();
+    };
+
+    for (auto iterator = m_renderableNodes.begin(); iterator != m_renderableNodes.end(); ++iterator) {
+        QSGSoftwareRenderableNode *node = *iterator;
+        if (node->type() != QSGSoftwareRenderableNode::RenderNode && !node->needsPainting()) {
+            dirtyRegion += node->markPainted();
+        } else if (node->canPaintConcurrently()) {
+            node->preparePaint(dpr);
+            run.append(node);
+        } else {
+            paintRun();
+            dirtyRegion += node->renderNode(painter, node == backgroundNode);
+        }
+    }
+    paintRun();
+
+    return dirtyRegion;
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
     m_renderableNodes.clear();
+    m_affectedRects.clear();
     // Add the background renderable (always first)
-    m_renderableNodes.append(renderableNode(m_background));
+    addToRenderList(renderableNode(m_background));
     // Build the renderlist
     QSGSoftwareRenderListBuilder(this).visitChildren(rootNode());
+    Q_ASSERT(m_subtreeStack.isEmpty());
+    activateSubtreeCaches();
 }
 
 QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
 {
+    // Everything that is repainted in this frame lies within the area of the
+    // dirty nodes, the regions they leave behind and those of removed nodes.
+    // Nodes entirely outside of it can neither become dirty nor hide anything
+    // that is repainted, so the region arithmetic below is only done for the
+    // nodes intersecting it. On a small update, that is just a few of them.
+    for (const QRect &r : m_dirtyRegion)
+        addAffectedRect(r);
+
+    QVector<QSGSoftwareRenderableNode *> affectedNodes;
+    affectedNodes.reserve(m_renderableNodes.count());
+    for (QSGSoftwareRenderableNode *node : qAsConst(m_renderableNodes)) {
+        if (isAffected(node->boundingRectMax()))
+            affectedNodes.append(node);
+    }
+    const bool allNodesAffected = affectedNodes.count() == m_renderableNodes.count();
+
     // Iterate through the renderlist from front to back
     // Objective is to update the dirty status and rects.
-    for (auto i = m_renderableNodes.rbegin(); i != m_renderableNodes.rend(); ++i) {
+    for (auto i = affectedNodes.crbegin(); i != affectedNodes.crend(); ++i) {
         auto node = *i;
         if (!m_dirtyRegion.isEmpty()) {
             // See if the current dirty regions apply to the current node
@@ -193,10 +579,14 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
         }
     }
 
-    if (m_obscuredRegion.contains(m_background->rect().toAlignedRect())) {
-        m_isOpaque = true;
-    } else {
-        m_isOpaque = false;
+    if (allNodesAffected) {
+        m_isOpaque = m_obscuredRegion.contains(m_background->rect().toAlignedRect());
+    } else if (m_isOpaque) {
+        // Outside of the affected area, the scene is covered as it was before
+        QRegion uncovered;
+        for (const QRect &r : qAsConst(m_affectedRects))
+            uncovered += r & m_background->rect().toAlignedRect();
+        m_isOpaque = (uncovered - m_obscuredRegion).isEmpty();
     }
 
     // Empty dirtyRegion (for second pass)
@@ -205,7 +595,7 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
 
     // Iterate through the renderlist from back to front
     // Objective is to make sure all non-opaque items are painted when an item under them is dirty
-    for (auto j = m_renderableNodes.begin(); j != m_renderableNodes.end(); ++j) {
+    for (auto j = affectedNodes.cbegin(); j != affectedNodes.cend(); ++j) {
         auto node = *j;
 
         if (!node->isOpaque() && !m_dirtyRegion.isEmpty()) {
@@ -264,6 +654,11 @@ void QSGAbstractSoftwareRenderer::nodeRemoved(QSGNode *node)
 {
     qCDebug(lc2DRender, "nodeRemoved %p", (void*)node);
 
+    if (QSGSoftwareSubtreeCache *cache = m_subtreeCaches.take(node)) {
+        deactivateSubtreeCache(cache);
+        delete cache;
+    }
+
     auto renderable = renderableNode(node);
     // remove mapping
     if (renderable != nullptr) {
@@ -52,13 +52,17 @@
 //
 
 #include <private/qsgrenderer_p.h>
+#include "qsgsoftwaresubtreecache_p.h"
 
 #include <QtCore/QHash>
 #include <QtCore/QLinkedList>
+#include <QtCore/QVector>
 
 QT_BEGIN_NAMESPACE
 
 class QSGSimpleRectNode;
+class QImage;
+class QThreadPool;
 
 class QSGSoftwareRenderableNode;
 class QSGSoftwareRenderableNodeUpdater;
@@ -72,12 +76,17 @@ public:
     QSGSoftwareRenderableNode *renderableNode(QSGNode *node) const;
     void addNodeMapping(QSGNode *node, QSGSoftwareRenderableNode *renderableNode);
     void appendRenderableNode(QSGSoftwareRenderableNode *node);
+    void beginSubtree(QSGNode *node);
+    void endSubtree(QSGNode *node);
+
+    const QSGSoftwareSubtreeCacheStatistics &subtreeCacheStatistics() const { return m_subtreeCacheStatistics; }
 
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
 
     void markDirty();
 
 protected:
+    void enableTiledRendering();
     QRegion renderNodes(QPainter *painter);
     void buildRenderList();
     QRegion optimizeRenderList();
@@ -90,6 +99,26 @@ protected:
     bool isOpaque() const { return m_isOpaque; }
 
 private:
+    struct SubtreeState {
+        QSGNode *node = nullptr;
+        bool collecting = false;
+        bool changed = false;
+        bool uncacheable = false;
+        int nodeCount = 0;
+        uint signature = 0;
+        QRect bounds;
+        QVector<QSGNode *> candidates;
+    };
+
+    QVector<QRect> tilesForRenderList(const QImage &image) const;
+    QRegion renderNodesInTiles(QPainter *painter, const QVector<QRect> &tiles);
+    void addAffectedRect(const QRect &rect);
+    bool isAffected(const QRect &rect) const;
+    void addToRenderList(QSGSoftwareRenderableNode *node);
+    void updateSubtreeCache(QSGNode *node, QSGSoftwareSubtreeCache *cache, SubtreeState &state);
+    void activateSubtreeCaches();
+    void deactivateSubtreeCache(QSGSoftwareSubtreeCache *cache);
+
     void nodeAdded(QSGNode *node);
     void nodeRemoved(QSGNode *node);
     void nodeGeometryUpdated(QSGNode *node);
@@ -104,9 +133,20 @@ private:
 
     QRegion m_dirtyRegion;
     QRegion m_obscuredRegion;
+    QVector<QRect> m_affectedRects;
     bool m_isOpaque = false;
 
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
+    QThreadPool *m_tilePool;
+
+    QVector<SubtreeState> m_subtreeStack;
+    QHash<QSGNode *, QSGSoftwareSubtreeCache *> m_subtreeCaches;
+    QVector<QSGNode *> m_subtreeCandidates;
+    QSGSoftwareSubtreeCache *m_collectingCache = nullptr;
+    QSGSoftwareSubtreeCacheStatistics m_subtreeCacheStatistics;
+    qint64 m_subtreeCacheBudget = 0;
+    qint64 m_subtreeCacheSize = 0;
+    qreal m_devicePixelRatio = 1;
 };
 
 QT_END_NAMESPACE
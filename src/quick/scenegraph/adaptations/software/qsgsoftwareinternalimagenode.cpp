@@ -322,6 +322,9 @@ QSGSoftwareInternalImageNode::QSGSoftwareInternalImageNode()
     : m_innerSourceRect(0, 0, 1, 1)
     , m_subSourceRect(0, 0, 1, 1)
     , m_texture(nullptr)
+    , m_scaledDevicePixelRatio(1)
+    , m_scaledPixmapCacheKey(0)
+    , m_requestedScaledCacheKey(0)
     , m_mirror(false)
     , m_textureIsLayer(false)
     , m_smooth(true)
@@ -463,9 +466,23 @@ static Qt::TileRule getTileRule(qreal factor)
 
 void QSGSoftwareInternalImageNode::paint(QPainter *painter)
 {
+    // The scaled pixmap only accounts for the node's own transform, so it can't be used when the
+    // painter's window is scaled to the device, as QSGSoftwarePixmapRenderer may do.
+    const bool unscaledView = !painter->viewTransformEnabled() || painter->window().size() == painter->viewport().size();
+    if (!m_scaledPixmap.isNull() && unscaledView && painter->transform() == m_scaledTransform
+            && qFuzzyCompare(painter->device()->devicePixelRatioF(), m_scaledDevicePixelRatio)) {
+        // Already scaled, so this is a straight blit, aligned to device pixels
+        const QPointF topLeft = m_scaledTransform.map(m_targetRect.topLeft()) * m_scaledDevicePixelRatio;
+        painter->setRenderHint(QPainter::SmoothPixmapTransform, false);
+        painter->setTransform(QTransform::fromTranslate(qRound(topLeft.x()) / m_scaledDevicePixelRatio,
+                                                        qRound(topLeft.y()) / m_scaledDevicePixelRatio));
+        painter->drawPixmap(QPointF(0, 0), m_scaledPixmap);
+        return;
+    }
+
     painter->setRenderHint(QPainter::SmoothPixmapTransform, m_smooth);
 
-    const QPixmap &pm = m_mirror || m_textureIsLayer ? m_cachedMirroredPixmap : pixmap();
+    const QPixmap &pm = sourcePixmap();
 
     if (m_innerTargetRect != m_targetRect) {
         // border image
@@ -494,6 +511,57 @@ void QSGSoftwareInternalImageNode::paint(QPainter *painter)
     }
 }
 
+/*
+  Smooth scaling makes QPainter go through its generic transformed image path
+  on every paint, on top of which comes the opacity. When the node is only
+  translated and scaled, the scaled image is instead produced once here, so
+  that painting it is a plain, pixel aligned blit. The raster engine does that,
+  with or without a constant opacity, with its SIMD blend functions.
+
+  Scaling is only done once the node has been prepared twice in a row for the
+  same source and size, as a node whose size changes on every frame, such as
+  during a scale animation, would otherwise be scaled on every frame as well.
+*/
+void QSGSoftwareInternalImageNode::updateScaledPixmap(const QTransform &transform, qreal devicePixelRatio)
+{
+    const QPixmap &pm = sourcePixmap();
+    const QRectF sr(m_subSourceRect.left() * pm.width(), m_subSourceRect.top() * pm.height(),
+                    m_subSourceRect.width() * pm.width(), m_subSourceRect.height() * pm.height());
+    const QSize size = (transform.mapRect(m_targetRect).size() * devicePixelRatio).toSize();
+
+    if (!m_smooth || pm.isNull() || m_innerTargetRect != m_targetRect || m_tileHorizontal || m_tileVertical
+            || transform.type() > QTransform::TxScale || transform.m11() <= 0 || transform.m22() <= 0
+            || QRectF(sr.toRect()) != sr || size.isEmpty()
+            || qint64(size.width()) * size.height() > qint64(pm.width()) * pm.height() * 4) {
+        // Nothing to gain, or more memory than it is worth
+        m_scaledPixmap = QPixmap();
+        return;
+    }
+
+    if (!m_scaledPixmap.isNull() && m_scaledPixmapCacheKey == pm.cacheKey() && m_scaledSourceRect == sr
+            && m_scaledPixmap.size() == size && qFuzzyCompare(m_scaledDevicePixelRatio, devicePixelRatio)) {
+        m_scaledTransform = transform;
+        return;
+    }
+
+    if (m_requestedScaledSize != size || m_requestedScaledSourceRect != sr
+            || m_requestedScaledCacheKey != pm.cacheKey()) {
+        m_requestedScaledSize = size;
+        m_requestedScaledSourceRect = sr;
+        m_requestedScaledCacheKey = pm.cacheKey();
+        m_scaledPixmap = QPixmap();
+        return;
+    }
+
+    const QPixmap source = sr.toRect() == pm.rect() ? pm : pm.copy(sr.toRect());
+    m_scaledPixmap = source.size() == size ? source : source.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    m_scaledPixmap.setDevicePixelRatio(devicePixelRatio);
+    m_scaledTransform = transform;
+    m_scaledSourceRect = sr;
+    m_scaledDevicePixelRatio = devicePixelRatio;
+    m_scaledPixmapCacheKey = pm.cacheKey();
+}
+
 QRectF QSGSoftwareInternalImageNode::rect() const
 {
     return m_targetRect;
@@ -510,4 +578,9 @@ const QPixmap &QSGSoftwareInternalImageNode::pixmap() const
     return nullPixmap;
 }
 
+const QPixmap &QSGSoftwareInternalImageNode::sourcePixmap() const
+{
+    return m_mirror || m_textureIsLayer ? m_cachedMirroredPixmap : pixmap();
+}
+
 QT_END_NAMESPACE
@@ -54,6 +54,8 @@
 #include <private/qsgadaptationlayer_p.h>
 #include <private/qsgtexturematerial_p.h>
 
+#include <QtGui/QTransform>
+
 QT_BEGIN_NAMESPACE
 
 namespace QSGSoftwareHelpers {
@@ -121,11 +123,13 @@ public:
     void preprocess() override;
 
     void paint(QPainter *painter);
+    void updateScaledPixmap(const QTransform &transform, qreal devicePixelRatio);
 
     QRectF rect() const;
 
     const QPixmap &pixmap() const;
 private:
+    const QPixmap &sourcePixmap() const;
 
     QRectF m_targetRect;
     QRectF m_innerTargetRect;
@@ -135,6 +139,17 @@ private:
     QSGTexture *m_texture;
     QPixmap m_cachedMirroredPixmap;
 
+    // The source rectangle prescaled to the size it is painted at
+    QPixmap m_scaledPixmap;
+    QTransform m_scaledTransform;
+    QRectF m_scaledSourceRect;
+    qreal m_scaledDevicePixelRatio;
+    qint64 m_scaledPixmapCacheKey;
+    // What the previous preparation would have scaled
+    QSize m_requestedScaledSize;
+    QRectF m_requestedScaledSourceRect;
+    qint64 m_requestedScaledCacheKey;
+
     bool m_mirror;
     bool m_textureIsLayer;
     bool m_smooth;
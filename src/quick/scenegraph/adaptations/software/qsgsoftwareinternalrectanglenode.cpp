@@ -227,10 +227,7 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 {
     //We can only check for a device pixel ratio change when we know what
     //paint device is being used.
-    if (!qFuzzyCompare(painter->device()->devicePixelRatioF(), m_devicePixelRatio)) {
-        m_devicePixelRatio = painter->device()->devicePixelRatioF();
-        generateCornerPixmap();
-    }
+    updateDevicePixelRatio(painter->device()->devicePixelRatioF());
 
     if (painter->transform().isRotating()) {
         //Rotated rectangles lose the benefits of direct rendering, and have poor rendering
@@ -265,6 +262,14 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 
 }
 
+void QSGSoftwareInternalRectangleNode::updateDevicePixelRatio(qreal ratio)
+{
+    if (!qFuzzyCompare(ratio, m_devicePixelRatio)) {
+        m_devicePixelRatio = ratio;
+        generateCornerPixmap();
+    }
+}
+
 bool QSGSoftwareInternalRectangleNode::isOpaque() const
 {
     if (m_radius > 0.0f)
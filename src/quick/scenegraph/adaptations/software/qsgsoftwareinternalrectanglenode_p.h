@@ -76,6 +76,7 @@ public:
     void update() override;
 
     void paint(QPainter *);
+    void updateDevicePixelRatio(qreal ratio);
 
     bool isOpaque() const;
     QRectF rect() const;
@@ -45,6 +45,7 @@
 #include "qsgsoftwarepublicnodes_p.h"
 #include "qsgsoftwarepainternode_p.h"
 #include "qsgsoftwarepixmaptexture_p.h"
+#include "qsgsoftwaresubtreecache_p.h"
 #if QT_CONFIG(quick_sprite)
 #include "qsgsoftwarespritenode_p.h"
 #endif
@@ -119,12 +120,23 @@ QSGSoftwareRenderableNode::QSGSoftwareRenderableNode(NodeType type, QSGNode *nod
     case QSGSoftwareRenderableNode::RenderNode:
         m_handle.renderNode = static_cast<QSGRenderNode*>(node);
         break;
+    case QSGSoftwareRenderableNode::CachedSubtree:
     case QSGSoftwareRenderableNode::Invalid:
         m_handle.simpleRectNode = nullptr;
         break;
     }
 }
 
+QSGSoftwareRenderableNode::QSGSoftwareRenderableNode(QSGSoftwareSubtreeCache *cache)
+    : m_nodeType(CachedSubtree)
+    , m_isOpaque(false)
+    , m_isDirty(true)
+    , m_hasClipRegion(false)
+    , m_opacity(1.0f)
+{
+    m_handle.subtreeCache = cache;
+}
+
 QSGSoftwareRenderableNode::~QSGSoftwareRenderableNode()
 {
 
@@ -201,6 +213,10 @@ void QSGSoftwareRenderableNode::update()
 
         boundingRect = m_handle.renderNode->rect();
         break;
+    case QSGSoftwareRenderableNode::CachedSubtree:
+        // Blended as a whole, whatever the nodes in the subtree are
+        boundingRect = m_handle.subtreeCache->rect();
+        break;
     default:
         break;
     }
@@ -247,14 +263,8 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
 {
     Q_ASSERT(painter);
 
-    // Check for don't paint conditions
-    if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
-    } else {
+    if (m_nodeType == RenderNode) {
+        // Check for don't paint conditions
         if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
             m_isDirty = false;
             m_dirtyRegion = QRegion();
@@ -286,12 +296,79 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         }
     }
 
+    if (needsPainting()) {
+        preparePaint(painter->device()->devicePixelRatioF());
+        paint(painter, forceOpaquePainting);
+    }
+
+    return markPainted();
+}
+
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    return m_isDirty && !qFuzzyIsNull(m_opacity) && !m_dirtyRegion.isEmpty();
+}
+
+/*
+  Sets up on the calling thread what the node would otherwise do lazily while
+  painting, or what only needs to be redone when the node has changed.
+*/
+void QSGSoftwareRenderableNode::preparePaint(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Image:
+        m_handle.imageNode->updateScaledPixmap(m_transform, devicePixelRatio);
+        break;
+    case QSGSoftwareRenderableNode::Rectangle:
+        m_handle.rectangleNode->updateDevicePixelRatio(devicePixelRatio);
+        break;
+    case QSGSoftwareRenderableNode::SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->ensureCachedMirroredPixmap();
+        break;
+    case QSGSoftwareRenderableNode::CachedSubtree:
+        m_handle.subtreeCache->updateImage(devicePixelRatio);
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+  Returns whether paint() may be called for this node from several threads at
+  once, each with its own painter, once preparePaint() has been called.
+*/
+bool QSGSoftwareRenderableNode::canPaintConcurrently() const
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Glyph:
+        // QRawFont and the font engine glyph caches are bound to the render thread
+    case QSGSoftwareRenderableNode::RenderNode:
+    case QSGSoftwareRenderableNode::Invalid:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/*
+  Paints the dirty region of the node, leaving its dirty state untouched so
+  that the same node can be painted into several disjoint parts of the target.
+*/
+void QSGSoftwareRenderableNode::paint(QPainter *painter, bool forceOpaquePainting) const
+{
+    paint(painter, m_dirtyRegion, forceOpaquePainting);
+}
+
+void QSGSoftwareRenderableNode::paint(QPainter *painter, const QRegion &region, bool forceOpaquePainting) const
+{
+    Q_ASSERT(m_nodeType != RenderNode);
+
     painter->save();
     painter->setOpacity(m_opacity);
 
-    // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
+    // Set clipRegion to region (in world coordinates, so must be done before the setTransform below)
     // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    painter->setClipRegion(region, Qt::ReplaceClip);
     if (m_clipRegion.rectCount() > 1)
         painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
 
@@ -341,11 +418,27 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         static_cast<QSGSoftwareSpriteNode *>(m_handle.spriteNode)->paint(painter);
         break;
 #endif
+    case QSGSoftwareRenderableNode::CachedSubtree:
+        m_handle.subtreeCache->paint(painter);
+        break;
     default:
         break;
     }
 
     painter->restore();
+}
+
+/*
+  Clears the dirty state after the node has been painted by paint() and
+  returns the area that needs to be flushed.
+*/
+QRegion QSGSoftwareRenderableNode::markPainted()
+{
+    if (!needsPainting()) {
+        m_isDirty = false;
+        m_dirtyRegion = QRegion();
+        return QRegion();
+    }
 
     QRegion areaToBeFlushed = m_dirtyRegion;
     m_previousDirtyRegion = QRegion(m_boundingRectMax);
@@ -71,6 +71,7 @@ class QSGSoftwareGlyphNode;
 class QSGSoftwareNinePatchNode;
 class QSGSoftwareSpriteNode;
 class QSGRenderNode;
+class QSGSoftwareSubtreeCache;
 
 class QSGSoftwareRenderableNode
 {
@@ -89,15 +90,24 @@ public:
 #if QT_CONFIG(quick_sprite)
         SpriteNode,
 #endif
-        RenderNode
+        RenderNode,
+        CachedSubtree
     };
 
     QSGSoftwareRenderableNode(NodeType type, QSGNode *node);
+    explicit QSGSoftwareRenderableNode(QSGSoftwareSubtreeCache *cache);
     ~QSGSoftwareRenderableNode();
 
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+
+    bool needsPainting() const;
+    void preparePaint(qreal devicePixelRatio);
+    bool canPaintConcurrently() const;
+    void paint(QPainter *painter, bool forceOpaquePainting = false) const;
+    void paint(QPainter *painter, const QRegion &region, bool forceOpaquePainting = false) const;
+    QRegion markPainted();
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
@@ -134,6 +144,7 @@ private:
         QSGImageNode *simpleImageNode;
         QSGSoftwareSpriteNode *spriteNode;
         QSGRenderNode *renderNode;
+        QSGSoftwareSubtreeCache *subtreeCache;
     };
 
     const NodeType m_nodeType;
@@ -57,6 +57,7 @@ QSGSoftwareRenderer::QSGSoftwareRenderer(QSGRenderContext *context)
     , m_paintDevice(nullptr)
     , m_backingStore(nullptr)
 {
+    enableTiledRendering();
 }
 
 QSGSoftwareRenderer::~QSGSoftwareRenderer()
@@ -161,7 +162,8 @@ void QSGSoftwareRenderer::render()
         m_backingStore->endPaint();
 
     rc->m_activePainter = prevPainter;
-    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime;
+    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime
+                        << "subtree cache hits/misses" << subtreeCacheStatistics().hits << subtreeCacheStatistics().misses;
 }
 
 QT_END_NAMESPACE
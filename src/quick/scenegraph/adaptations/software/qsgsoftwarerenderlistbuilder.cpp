@@ -60,13 +60,15 @@ QSGSoftwareRenderListBuilder::QSGSoftwareRenderListBuilder(QSGAbstractSoftwareRe
 
 }
 
-bool QSGSoftwareRenderListBuilder::visit(QSGTransformNode *)
+bool QSGSoftwareRenderListBuilder::visit(QSGTransformNode *node)
 {
+    m_renderer->beginSubtree(node);
     return true;
 }
 
-void QSGSoftwareRenderListBuilder::endVisit(QSGTransformNode *)
+void QSGSoftwareRenderListBuilder::endVisit(QSGTransformNode *node)
 {
+    m_renderer->endSubtree(node);
 }
 
 bool QSGSoftwareRenderListBuilder::visit(QSGClipNode *)
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsgsoftwaresubtreecache_p.h"
+#include "qsgsoftwarerenderablenode_p.h"
+
+#include <QtGui/QPainter>
+
+QT_BEGIN_NAMESPACE
+
+QSGSoftwareSubtreeCache::QSGSoftwareSubtreeCache(QSGSoftwareSubtreeCacheStatistics *statistics)
+    : nodeCount(0)
+    , signature(0)
+    , stableFrames(0)
+    , m_statistics(statistics)
+    , m_proxy(nullptr)
+    , m_reservedBytes(0)
+{
+}
+
+QSGSoftwareSubtreeCache::~QSGSoftwareSubtreeCache()
+{
+    delete m_proxy;
+}
+
+void QSGSoftwareSubtreeCache::activate(const QRect &rect, const QRect &backgroundRect, qint64 reservedBytes)
+{
+    Q_ASSERT(!m_proxy);
+    m_rect = rect;
+    m_backgroundRect = backgroundRect;
+    m_reservedBytes = reservedBytes;
+
+    // What is on screen already matches the subtree, so the proxy starts clean
+    m_proxy = new QSGSoftwareRenderableNode(this);
+    m_proxy->update();
+    m_proxy->markPainted();
+}
+
+void QSGSoftwareSubtreeCache::deactivate()
+{
+    delete m_proxy;
+    m_proxy = nullptr;
+    m_image = QImage();
+    m_reservedBytes = 0;
+    stableFrames = 0;
+    nodes.clear();
+}
+
+/*
+  Paints the nodes of the subtree into the cached image, unless it is already
+  up to date. This paints glyphs and must be done on the render thread.
+*/
+void QSGSoftwareSubtreeCache::updateImage(qreal devicePixelRatio)
+{
+    if (!m_image.isNull() && qFuzzyCompare(m_image.devicePixelRatioF(), devicePixelRatio)) {
+        ++m_statistics->hits;
+        return;
+    }
+    ++m_statistics->misses;
+
+    m_image = QImage(m_rect.size() * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    m_image.setDevicePixelRatio(devicePixelRatio);
+    m_image.fill(Qt::transparent);
+
+    QPainter painter(&m_image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setWindow(m_rect);
+    for (QSGSoftwareRenderableNode *node : qAsConst(nodes)) {
+        if (qFuzzyIsNull(node->opacity()) || node->boundingRectMax().isEmpty())
+            continue;
+        node->preparePaint(devicePixelRatio);
+        node->paint(&painter, QRegion(node->boundingRectMax()));
+    }
+}
+
+void QSGSoftwareSubtreeCache::paint(QPainter *painter) const
+{
+    if (!m_image.isNull())
+        painter->drawImage(m_rect.topLeft(), m_image);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSGSOFTWARESUBTREECACHE_H
+#define QSGSOFTWARESUBTREECACHE_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+#include <QtCore/QRect>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
+
+QT_BEGIN_NAMESPACE
+
+class QPainter;
+class QSGSoftwareRenderableNode;
+
+struct QSGSoftwareSubtreeCacheStatistics
+{
+    int hits = 0;
+    int misses = 0;
+};
+
+/*
+  Keeps track of a subtree of the scene graph that is a candidate for being
+  painted from a cached image. Once the renderable nodes in the subtree have
+  not changed for a number of frames, the subtree is represented in the render
+  list by a single proxy node, which paints the cached image instead.
+*/
+class QSGSoftwareSubtreeCache
+{
+public:
+    QSGSoftwareSubtreeCache(QSGSoftwareSubtreeCacheStatistics *statistics);
+    ~QSGSoftwareSubtreeCache();
+
+    bool isActive() const { return m_proxy != nullptr; }
+    QSGSoftwareRenderableNode *proxy() const { return m_proxy; }
+    void activate(const QRect &rect, const QRect &backgroundRect, qint64 reservedBytes);
+    void deactivate();
+
+    QRect rect() const { return m_rect; }
+    QRect backgroundRect() const { return m_backgroundRect; }
+    qint64 reservedBytes() const { return m_reservedBytes; }
+
+    void updateImage(qreal devicePixelRatio);
+    void paint(QPainter *painter) const;
+
+    // The state of the subtree seen while building the render list
+    int nodeCount;
+    uint signature;
+    int stableFrames;
+    QRect bounds;
+    QVector<QSGSoftwareRenderableNode *> nodes;
+
+private:
+    QSGSoftwareSubtreeCacheStatistics *m_statistics;
+    QSGSoftwareRenderableNode *m_proxy;
+    QRect m_rect;
+    QRect m_backgroundRect;
+    qint64 m_reservedBytes;
+    QImage m_image;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSGSOFTWARESUBTREECACHE_H
@@ -19,7 +19,8 @@ SOURCES += \
     $$PWD/qsgsoftwarerenderloop.cpp \
     $$PWD/qsgsoftwarelayer.cpp \
     $$PWD/qsgsoftwareadaptation.cpp \
-    $$PWD/qsgsoftwarethreadedrenderloop.cpp
+    $$PWD/qsgsoftwarethreadedrenderloop.cpp \
+    $$PWD/qsgsoftwaresubtreecache.cpp
 
 HEADERS += \
     $$PWD/qsgsoftwarecontext_p.h \
@@ -38,7 +39,8 @@ HEADERS += \
     $$PWD/qsgsoftwarerenderloop_p.h \
     $$PWD/qsgsoftwarelayer_p.h \
     $$PWD/qsgsoftwareadaptation_p.h \
-    $$PWD/qsgsoftwarethreadedrenderloop_p.h
+    $$PWD/qsgsoftwarethreadedrenderloop_p.h \
+    $$PWD/qsgsoftwaresubtreecache_p.h
 
 qtConfig(quick-sprite) {
     SOURCES += \
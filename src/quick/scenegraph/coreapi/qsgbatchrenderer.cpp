@@ -46,7 +46,10 @@
 
 #include <qmath.h>
 
+#include <QtCore/QAtomicInt>
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
 #include <QtCore/QtNumeric>
 
 #include <QtGui/QGuiApplication>
@@ -472,19 +475,24 @@ void Updater::visitGeometryNode(Node *n)
         e->translateOnlyToRoot = QMatrix4x4_Accessor::isTranslate(*gn->matrix());
 
         if (e->root) {
-            BatchRootInfo *info = renderer->batchRootInfo(e->root);
-            while (info != nullptr) {
+            // The element takes one of the spare render orders of every root
+            // it is in. Only the innermost root which still has room for it
+            // needs its render lists rebuilt, the roots within are laid out
+            // anew as part of that.
+            Node *root = e->root;
+            Node *rebuildRoot = nullptr;
+            while (root != nullptr) {
+                BatchRootInfo *info = renderer->batchRootInfo(root);
                 info->availableOrders--;
-                if (info->availableOrders < 0) {
-                    renderer->m_rebuild |= Renderer::BuildRenderLists;
-                } else {
-                    renderer->m_rebuild |= Renderer::BuildRenderListsForTaggedRoots;
-                    renderer->m_taggedRoots << e->root;
-                }
-                if (info->parentRoot != nullptr)
-                    info = renderer->batchRootInfo(info->parentRoot);
-                else
-                    info = nullptr;
+                if (!rebuildRoot && info->availableOrders >= 0)
+                    rebuildRoot = root;
+                root = info->parentRoot;
+            }
+            if (rebuildRoot) {
+                renderer->m_rebuild |= Renderer::BuildRenderListsForTaggedRoots;
+                renderer->m_taggedRoots << rebuildRoot;
+            } else {
+                renderer->m_rebuild |= Renderer::BuildRenderLists;
             }
         } else {
             renderer->m_rebuild |= Renderer::FullRebuild;
@@ -757,6 +765,7 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_nextRenderOrder(0)
     , m_partialRebuild(false)
     , m_partialRebuildRoot(nullptr)
+    , m_partialRebuildOverflow(false)
     , m_useDepthBuffer(true)
     , m_opaqueBatches(16)
     , m_alphaBatches(16)
@@ -768,6 +777,8 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_zRange(0)
     , m_renderOrderRebuildLower(-1)
     , m_renderOrderRebuildUpper(-1)
+    , m_fullRebuildCount(0)
+    , m_partialRebuildCount(0)
     , m_currentMaterial(nullptr)
     , m_currentShader(nullptr)
     , m_currentStencilValue(0)
@@ -776,6 +787,7 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_currentClipType(NoClip)
     , m_vertexUploadPool(256)
     , m_indexUploadPool(64)
+    , m_uploadThreadPool(nullptr)
     , m_vao(nullptr)
     , m_visualizeMode(VisualizeNothing)
 {
@@ -802,9 +814,16 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
 
+    const int uploadThreads = qt_sg_envInt("QSG_RENDERER_UPLOAD_THREADS", 1);
+    if (uploadThreads > 1) {
+        m_uploadThreadPool = new QThreadPool;
+        m_uploadThreadPool->setMaxThreadCount(uploadThreads - 1);
+    }
+
     if (Q_UNLIKELY(debug_build() || debug_render())) {
         qDebug("Batch thresholds: nodes: %d vertices: %d",
                m_batchNodeThreshold, m_batchVertexThreshold);
+        qDebug("Preparing uploads on %d threads", qMax(uploadThreads, 1));
         qDebug("Using buffer strategy: %s",
                (m_bufferStrategy == GL_STATIC_DRAW
                 ? "static" : (m_bufferStrategy == GL_DYNAMIC_DRAW ? "dynamic" : "stream")));
@@ -853,6 +872,8 @@ Renderer::~Renderer()
             qsg_wipeBatch(m_batchPool.at(i), this, separateIndexBuffer);
     }
 
+    delete m_uploadThreadPool;
+
     for (Node *n : qAsConst(m_nodes))
         m_nodeAllocator.release(n);
 
@@ -1080,15 +1101,15 @@ void Renderer::nodeWasRemoved(Node *node)
         }
 
     } else if (node->type() == QSGNode::ClipNodeType) {
+        // All elements below have been removed above, which leaves their
+        // batches empty, so the render lists of the rest can be kept.
         removeBatchRootFromParent(node);
         delete node->clipInfo();
-        m_rebuild |= FullRebuild;
         m_taggedRoots.remove(node);
 
     } else if (node->isBatchRoot) {
         removeBatchRootFromParent(node);
         delete node->rootInfo();
-        m_rebuild |= FullRebuild;
         m_taggedRoots.remove(node);
 
     } else if (node->type() == QSGNode::RenderNodeType) {
@@ -1316,6 +1337,9 @@ void Renderer::buildRenderLists(QSGNode *node)
             m_nextRenderOrder = info->firstOrder;
             QSGNODE_TRAVERSE(node)
                     buildRenderLists(child);
+            // Roots within get new padding, which may not fit the range of this one
+            if (m_nextRenderOrder > info->lastOrder)
+                m_partialRebuildOverflow = true;
             m_nextRenderOrder = info->lastOrder + 1;
         } else {
             int currentOrder = m_nextRenderOrder;
@@ -1421,6 +1445,7 @@ void Renderer::buildRenderListsForTaggedRoots()
     m_alphaRenderList.reset();
     int maxRenderOrder = m_nextRenderOrder;
     m_partialRebuild = true;
+    m_partialRebuildOverflow = false;
     // Traverse each root, assigning it
     for (QSet<Node *>::const_iterator it = m_taggedRoots.constBegin();
          it != m_taggedRoots.constEnd(); ++it) {
@@ -1777,223 +1802,374 @@ static QMatrix4x4 qsg_matrixForRoot(Node *node)
     return *c->matrix();
 }
 
-void Renderer::uploadBatch(Batch *b)
+/*
+ * Decides whether the batch \a b needs to be uploaded, and if so, whether it
+ * can be merged and how many bytes its vertex and index buffers take.
+ * Returns false if there is nothing to upload.
+ */
+bool Renderer::prepareBatchUpload(Batch *b, int *vertexBufferSize, int *indexBufferSize)
 {
-        // Early out if nothing has changed in this batch..
-        if (!b->needsUpload) {
-            if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
-            return;
-        }
-
-        if (!b->first) {
-            if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
-            return;
-        }
+    // Early out if nothing has changed in this batch..
+    if (!b->needsUpload) {
+        if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
+        return false;
+    }
 
-        if (b->isRenderNode) {
-            if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch: " << b << "is a render node...";
-            return;
-        }
+    if (!b->first) {
+        if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
+        return false;
+    }
 
-        // Figure out if we can merge or not, if not, then just render the batch as is..
-        Q_ASSERT(b->first);
-        Q_ASSERT(b->first->node);
-
-        QSGGeometryNode *gn = b->first->node;
-        QSGGeometry *g =  gn->geometry();
-        QSGMaterial::Flags flags = gn->activeMaterial()->flags();
-        bool canMerge = (g->drawingMode() == GL_TRIANGLES || g->drawingMode() == GL_TRIANGLE_STRIP ||
-                         g->drawingMode() == GL_LINES || g->drawingMode() == GL_POINTS)
-                        && b->positionAttribute >= 0
-                        && g->indexType() == GL_UNSIGNED_SHORT
-                        && (flags & (QSGMaterial::CustomCompileStep | QSGMaterial_FullMatrix)) == 0
-                        && ((flags & QSGMaterial::RequiresFullMatrixExceptTranslate) == 0 || b->isTranslateOnlyToRoot())
-                        && b->isSafeToBatch();
-
-        b->merged = canMerge;
-
-        // Figure out how much memory we need...
-        b->vertexCount = 0;
-        b->indexCount = 0;
-        int unmergedIndexSize = 0;
-        Element *e = b->first;
+    if (b->isRenderNode) {
+        if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch: " << b << "is a render node...";
+        return false;
+    }
 
-        while (e) {
-            QSGGeometry *eg = e->node->geometry();
-            b->vertexCount += eg->vertexCount();
-            int iCount = eg->indexCount();
-            if (b->merged) {
-                if (iCount == 0)
-                    iCount = eg->vertexCount();
-                iCount = qsg_fixIndexCount(iCount, g->drawingMode());
-            } else {
-                unmergedIndexSize += iCount * eg->sizeOfIndex();
-            }
-            b->indexCount += iCount;
-            e = e->nextInBatch;
-        }
+    // Figure out if we can merge or not, if not, then just render the batch as is..
+    Q_ASSERT(b->first);
+    Q_ASSERT(b->first->node);
 
-        // Abort if there are no vertices in this batch.. We abort this late as
-        // this is a broken usecase which we do not care to optimize for...
-        if (b->vertexCount == 0 || (b->merged && b->indexCount == 0))
-            return;
+    QSGGeometryNode *gn = b->first->node;
+    QSGGeometry *g =  gn->geometry();
+    QSGMaterial::Flags flags = gn->activeMaterial()->flags();
+    bool canMerge = (g->drawingMode() == GL_TRIANGLES || g->drawingMode() == GL_TRIANGLE_STRIP ||
+                     g->drawingMode() == GL_LINES || g->drawingMode() == GL_POINTS)
+                    && b->positionAttribute >= 0
+                    && g->indexType() == GL_UNSIGNED_SHORT
+                    && (flags & (QSGMaterial::CustomCompileStep | QSGMaterial_FullMatrix)) == 0
+                    && ((flags & QSGMaterial::RequiresFullMatrixExceptTranslate) == 0 || b->isTranslateOnlyToRoot())
+                    && b->isSafeToBatch();
+
+    b->merged = canMerge;
+
+    // Figure out how much memory we need...
+    b->vertexCount = 0;
+    b->indexCount = 0;
+    int unmergedIndexSize = 0;
+    Element *e = b->first;
 
-        /* Allocate memory for this batch. Merged batches are divided into three separate blocks
-           1. Vertex data for all elements, as they were in the QSGGeometry object, but
-              with the tranform relative to this batch's root applied. The vertex data
-              is otherwise unmodified.
-           2. Z data for all elements, derived from each elements "render order".
-              This is present for merged data only.
-           3. Indices for all elements, as they were in the QSGGeometry object, but
-              adjusted so that each index matches its.
-              And for TRIANGLE_STRIPs, we need to insert degenerate between each
-              primitive. These are unsigned shorts for merged and arbitrary for
-              non-merged.
-         */
-        int bufferSize =  b->vertexCount * g->sizeOfVertex();
-        int ibufferSize = 0;
+    while (e) {
+        QSGGeometry *eg = e->node->geometry();
+        b->vertexCount += eg->vertexCount();
+        int iCount = eg->indexCount();
         if (b->merged) {
-            ibufferSize = b->indexCount * sizeof(quint16);
-            if (m_useDepthBuffer)
-                bufferSize += b->vertexCount * sizeof(float);
+            if (iCount == 0)
+                iCount = eg->vertexCount();
+            iCount = qsg_fixIndexCount(iCount, g->drawingMode());
         } else {
-            ibufferSize = unmergedIndexSize;
+            unmergedIndexSize += iCount * eg->sizeOfIndex();
         }
+        b->indexCount += iCount;
+        e = e->nextInBatch;
+    }
 
-        const bool separateIndexBuffer = m_context->separateIndexBuffer();
-        if (separateIndexBuffer)
-            map(&b->ibo, ibufferSize, true);
-        else
-            bufferSize += ibufferSize;
-        map(&b->vbo, bufferSize);
+    // Abort if there are no vertices in this batch.. We abort this late as
+    // this is a broken usecase which we do not care to optimize for...
+    if (b->vertexCount == 0 || (b->merged && b->indexCount == 0))
+        return false;
+
+    /* Allocate memory for this batch. Merged batches are divided into three separate blocks
+       1. Vertex data for all elements, as they were in the QSGGeometry object, but
+          with the tranform relative to this batch's root applied. The vertex data
+          is otherwise unmodified.
+       2. Z data for all elements, derived from each elements "render order".
+          This is present for merged data only.
+       3. Indices for all elements, as they were in the QSGGeometry object, but
+          adjusted so that each index matches its.
+          And for TRIANGLE_STRIPs, we need to insert degenerate between each
+          primitive. These are unsigned shorts for merged and arbitrary for
+          non-merged.
+     */
+    int bufferSize =  b->vertexCount * g->sizeOfVertex();
+    int ibufferSize = 0;
+    if (b->merged) {
+        ibufferSize = b->indexCount * sizeof(quint16);
+        if (m_useDepthBuffer)
+            bufferSize += b->vertexCount * sizeof(float);
+    } else {
+        ibufferSize = unmergedIndexSize;
+    }
 
-        if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
-                                   << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
-                                   << " vbo:" << b->vbo.id << ":" << b->vbo.size;
+    *vertexBufferSize = bufferSize;
+    *indexBufferSize = ibufferSize;
+    return true;
+}
 
-        if (b->merged) {
-            char *vertexData = b->vbo.data;
-            char *zData = vertexData + b->vertexCount * g->sizeOfVertex();
-            char *indexData = separateIndexBuffer
-                    ? b->ibo.data
-                    : zData + (int(m_useDepthBuffer) * b->vertexCount * sizeof(float));
-
-            quint16 iOffset = 0;
-            e = b->first;
-            int verticesInSet = 0;
-            int indicesInSet = 0;
-            b->drawSets.reset();
-            int drawSetIndices = separateIndexBuffer ? 0 : indexData - vertexData;
-            const auto indexBase = separateIndexBuffer ? b->ibo.data : b->vbo.data;
-            b->drawSets << DrawSet(0, zData - vertexData, drawSetIndices);
-            while (e) {
-                verticesInSet  += e->node->geometry()->vertexCount();
-                if (verticesInSet > 0xffff) {
-                    b->drawSets.last().indexCount = indicesInSet;
-                    if (g->drawingMode() == GL_TRIANGLE_STRIP) {
-                        b->drawSets.last().indices += 1 * sizeof(quint16);
-                        b->drawSets.last().indexCount -= 2;
-                    }
-                    drawSetIndices = indexData - indexBase;
-                    b->drawSets << DrawSet(vertexData - b->vbo.data,
-                                           zData - b->vbo.data,
-                                           drawSetIndices);
-                    iOffset = 0;
-                    verticesInSet = e->node->geometry()->vertexCount();
-                    indicesInSet = 0;
+/*
+ * Fills the mapped vertex and index buffers of the batch \a b. This only
+ * touches the batch itself and the geometry of its elements, so independent
+ * batches can be filled concurrently.
+ */
+void Renderer::fillBatch(Batch *b, bool separateIndexBuffer)
+{
+    QSGGeometry *g = b->first->node->geometry();
+
+    if (b->merged) {
+        char *vertexData = b->vbo.data;
+        char *zData = vertexData + b->vertexCount * g->sizeOfVertex();
+        char *indexData = separateIndexBuffer
+                ? b->ibo.data
+                : zData + (int(m_useDepthBuffer) * b->vertexCount * sizeof(float));
+
+        quint16 iOffset = 0;
+        Element *e = b->first;
+        int verticesInSet = 0;
+        int indicesInSet = 0;
+        b->drawSets.reset();
+        int drawSetIndices = separateIndexBuffer ? 0 : indexData - vertexData;
+        const auto indexBase = separateIndexBuffer ? b->ibo.data : b->vbo.data;
+        b->drawSets << DrawSet(0, zData - vertexData, drawSetIndices);
+        while (e) {
+            verticesInSet  += e->node->geometry()->vertexCount();
+            if (verticesInSet > 0xffff) {
+                b->drawSets.last().indexCount = indicesInSet;
+                if (g->drawingMode() == GL_TRIANGLE_STRIP) {
+                    b->drawSets.last().indices += 1 * sizeof(quint16);
+                    b->drawSets.last().indexCount -= 2;
                 }
-                uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, &iOffset, &indicesInSet);
-                e = e->nextInBatch;
+                drawSetIndices = indexData - indexBase;
+                b->drawSets << DrawSet(vertexData - b->vbo.data,
+                                       zData - b->vbo.data,
+                                       drawSetIndices);
+                iOffset = 0;
+                verticesInSet = e->node->geometry()->vertexCount();
+                indicesInSet = 0;
             }
-            b->drawSets.last().indexCount = indicesInSet;
-            // We skip the very first and very last degenerate triangles since they aren't needed
-            // and the first one would reverse the vertex ordering of the merged strips.
-            if (g->drawingMode() == GL_TRIANGLE_STRIP) {
-                b->drawSets.last().indices += 1 * sizeof(quint16);
-                b->drawSets.last().indexCount -= 2;
-            }
-        } else {
-            char *vboData = b->vbo.data;
-            char *iboData = separateIndexBuffer ? b->ibo.data
-                                                : vboData + b->vertexCount * g->sizeOfVertex();
-            Element *e = b->first;
-            while (e) {
-                QSGGeometry *g = e->node->geometry();
-                int vbs = g->vertexCount() * g->sizeOfVertex();
-                memcpy(vboData, g->vertexData(), vbs);
-                vboData = vboData + vbs;
-                if (g->indexCount()) {
-                    int ibs = g->indexCount() * g->sizeOfIndex();
-                    memcpy(iboData, g->indexData(), ibs);
-                    iboData += ibs;
-                }
-                e = e->nextInBatch;
+            uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, &iOffset, &indicesInSet);
+            e = e->nextInBatch;
+        }
+        b->drawSets.last().indexCount = indicesInSet;
+        // We skip the very first and very last degenerate triangles since they aren't needed
+        // and the first one would reverse the vertex ordering of the merged strips.
+        if (g->drawingMode() == GL_TRIANGLE_STRIP) {
+            b->drawSets.last().indices += 1 * sizeof(quint16);
+            b->drawSets.last().indexCount -= 2;
+        }
+    } else {
+        char *vboData = b->vbo.data;
+        char *iboData = separateIndexBuffer ? b->ibo.data
+                                            : vboData + b->vertexCount * g->sizeOfVertex();
+        Element *e = b->first;
+        while (e) {
+            QSGGeometry *g = e->node->geometry();
+            int vbs = g->vertexCount() * g->sizeOfVertex();
+            memcpy(vboData, g->vertexData(), vbs);
+            vboData = vboData + vbs;
+            if (g->indexCount()) {
+                int ibs = g->indexCount() * g->sizeOfIndex();
+                memcpy(iboData, g->indexData(), ibs);
+                iboData += ibs;
             }
+            e = e->nextInBatch;
         }
+    }
+}
+
+/*
+ * Hands the filled buffers of the batch \a b over to OpenGL. This must be
+ * called on the render thread.
+ */
+void Renderer::finishBatchUpload(Batch *b, bool separateIndexBuffer)
+{
 #ifndef QT_NO_DEBUG_OUTPUT
-        if (Q_UNLIKELY(debug_upload())) {
-            const char *vd = b->vbo.data;
-            qDebug() << "  -- Vertex Data, count:" << b->vertexCount << " - " << g->sizeOfVertex() << "bytes/vertex";
-            for (int i=0; i<b->vertexCount; ++i) {
-                QDebug dump = qDebug().nospace();
-                dump << "  --- " << i << ": ";
-                int offset = 0;
-                for (int a=0; a<g->attributeCount(); ++a) {
-                    const QSGGeometry::Attribute &attr = g->attributes()[a];
-                    dump << attr.position << ":(" << attr.tupleSize << ",";
-                    if (attr.type == GL_FLOAT) {
-                        dump << "float ";
-                        if (attr.isVertexCoordinate)
-                            dump << "* ";
-                        for (int t=0; t<attr.tupleSize; ++t)
-                            dump << *(const float *)(vd + offset + t * sizeof(float)) << " ";
-                    } else if (attr.type == GL_UNSIGNED_BYTE) {
-                        dump << "ubyte ";
-                        for (int t=0; t<attr.tupleSize; ++t)
-                            dump << *(const unsigned char *)(vd + offset + t * sizeof(unsigned char)) << " ";
-                    }
-                    dump << ") ";
-                    offset += attr.tupleSize * size_of_type(attr.type);
-                }
-                if (b->merged && m_useDepthBuffer) {
-                    float zorder = ((float*)(b->vbo.data + b->vertexCount * g->sizeOfVertex()))[i];
-                    dump << " Z:(" << zorder << ")";
+    QSGGeometry *g = b->first->node->geometry();
+    if (Q_UNLIKELY(debug_upload())) {
+        const char *vd = b->vbo.data;
+        qDebug() << "  -- Vertex Data, count:" << b->vertexCount << " - " << g->sizeOfVertex() << "bytes/vertex";
+        for (int i=0; i<b->vertexCount; ++i) {
+            QDebug dump = qDebug().nospace();
+            dump << "  --- " << i << ": ";
+            int offset = 0;
+            for (int a=0; a<g->attributeCount(); ++a) {
+                const QSGGeometry::Attribute &attr = g->attributes()[a];
+                dump << attr.position << ":(" << attr.tupleSize << ",";
+                if (attr.type == GL_FLOAT) {
+                    dump << "float ";
+                    if (attr.isVertexCoordinate)
+                        dump << "* ";
+                    for (int t=0; t<attr.tupleSize; ++t)
+                        dump << *(const float *)(vd + offset + t * sizeof(float)) << " ";
+                } else if (attr.type == GL_UNSIGNED_BYTE) {
+                    dump << "ubyte ";
+                    for (int t=0; t<attr.tupleSize; ++t)
+                        dump << *(const unsigned char *)(vd + offset + t * sizeof(unsigned char)) << " ";
                 }
-                vd += g->sizeOfVertex();
+                dump << ") ";
+                offset += attr.tupleSize * size_of_type(attr.type);
+            }
+            if (b->merged && m_useDepthBuffer) {
+                float zorder = ((float*)(b->vbo.data + b->vertexCount * g->sizeOfVertex()))[i];
+                dump << " Z:(" << zorder << ")";
             }
+            vd += g->sizeOfVertex();
+        }
 
-            if (!b->drawSets.isEmpty()) {
-                const quint16 *id = (const quint16 *)(separateIndexBuffer
-                                                      ? b->ibo.data
-                                                      : b->vbo.data + b->drawSets.at(0).indices);
-                {
-                    QDebug iDump = qDebug();
-                    iDump << "  -- Index Data, count:" << b->indexCount;
-                    for (int i=0; i<b->indexCount; ++i) {
-                        if ((i % 24) == 0)
-                           iDump << endl << "  --- ";
-                        iDump << id[i];
-                    }
+        if (!b->drawSets.isEmpty()) {
+            const quint16 *id = (const quint16 *)(separateIndexBuffer
+                                                  ? b->ibo.data
+                                                  : b->vbo.data + b->drawSets.at(0).indices);
+            {
+                QDebug iDump = qDebug();
+                iDump << "  -- Index Data, count:" << b->indexCount;
+                for (int i=0; i<b->indexCount; ++i) {
+                    if ((i % 24) == 0)
+                       iDump << endl << "  --- ";
+                    iDump << id[i];
                 }
+            }
 
-                for (int i=0; i<b->drawSets.size(); ++i) {
-                    const DrawSet &s = b->drawSets.at(i);
-                    qDebug() << "  -- DrawSet: indexCount:" << s.indexCount << " vertices:" << s.vertices << " z:" << s.zorders << " indices:" << s.indices;
-                }
+            for (int i=0; i<b->drawSets.size(); ++i) {
+                const DrawSet &s = b->drawSets.at(i);
+                qDebug() << "  -- DrawSet: indexCount:" << s.indexCount << " vertices:" << s.vertices << " z:" << s.zorders << " indices:" << s.indices;
             }
         }
+    }
 #endif // QT_NO_DEBUG_OUTPUT
 
-        unmap(&b->vbo);
+    m_statistics.uploadedBytes += b->vbo.size;
+    unmap(&b->vbo);
+    if (separateIndexBuffer) {
+        m_statistics.uploadedBytes += b->ibo.size;
+        unmap(&b->ibo, true);
+    }
+
+    if (Q_UNLIKELY(debug_upload())) qDebug() << "  --- vertex/index buffers unmapped, batch upload completed...";
+
+    b->needsUpload = false;
+
+    if (Q_UNLIKELY(debug_render()))
+        b->uploadedThisFrame = true;
+}
+
+// Below this many vertices, handing batches to other threads does not pay off
+static const int qsg_concurrent_upload_vertex_threshold = 8192;
+
+static inline int qsg_alignedUploadSize(int size)
+{
+    return (size + 15) & ~15;
+}
+
+class BatchUploader : public QRunnable
+{
+public:
+    BatchUploader(Renderer *renderer, const QVector<Batch *> &batches, QAtomicInt *next, bool separateIndexBuffer)
+        : m_renderer(renderer)
+        , m_batches(batches)
+        , m_next(next)
+        , m_separateIndexBuffer(separateIndexBuffer)
+    {
+    }
+
+    void run() override
+    {
+        for (int i = m_next->fetchAndAddRelaxed(1); i < m_batches.size(); i = m_next->fetchAndAddRelaxed(1))
+            m_renderer->fillBatch(m_batches.at(i), m_separateIndexBuffer);
+    }
+
+private:
+    Renderer *m_renderer;
+    const QVector<Batch *> &m_batches;
+    QAtomicInt *m_next;
+    bool m_separateIndexBuffer;
+};
+
+/*
+ * Uploads all opaque and alpha batches, filling their buffers on the upload
+ * thread pool. Every batch gets its own part of the upload pools, so that
+ * they can be filled independently, and only the buffer uploads themselves
+ * are done on the render thread afterwards.
+ *
+ * This requires the upload pools to be in use, see map().
+ */
+void Renderer::uploadBatchesConcurrently(int *vertexUploadSize, int *indexUploadSize)
+{
+    const bool separateIndexBuffer = m_context->separateIndexBuffer();
+
+    QVector<Batch *> batches;
+    QVector<int> vertexOffsets;
+    QVector<int> indexOffsets;
+    int vertexPoolSize = 0;
+    int indexPoolSize = 0;
+    int vertexCount = 0;
+    *vertexUploadSize = 0;
+    *indexUploadSize = 0;
+    for (QDataBuffer<Batch *> *list : { &m_opaqueBatches, &m_alphaBatches }) {
+        for (int i = 0; i < list->size(); ++i) {
+            Batch *b = list->at(i);
+            int bufferSize;
+            int ibufferSize;
+            if (!prepareBatchUpload(b, &bufferSize, &ibufferSize)) {
+                // Keep the pools large enough for when all batches change at once
+                *vertexUploadSize += qsg_alignedUploadSize(b->vbo.size);
+                *indexUploadSize += qsg_alignedUploadSize(b->ibo.size);
+                continue;
+            }
+
+            if (separateIndexBuffer) {
+                b->ibo.size = ibufferSize;
+                indexOffsets << indexPoolSize;
+                indexPoolSize += qsg_alignedUploadSize(ibufferSize);
+            } else {
+                bufferSize += ibufferSize;
+            }
+            b->vbo.size = bufferSize;
+            vertexOffsets << vertexPoolSize;
+            vertexPoolSize += qsg_alignedUploadSize(bufferSize);
+            vertexCount += b->vertexCount;
+            batches << b;
+        }
+    }
+
+    if (vertexPoolSize > m_vertexUploadPool.size())
+        m_vertexUploadPool.resize(vertexPoolSize);
+    if (indexPoolSize > m_indexUploadPool.size())
+        m_indexUploadPool.resize(indexPoolSize);
+    for (int i = 0; i < batches.size(); ++i) {
+        Batch *b = batches.at(i);
+        b->vbo.data = m_vertexUploadPool.data() + vertexOffsets.at(i);
         if (separateIndexBuffer)
-            unmap(&b->ibo, true);
+            b->ibo.data = m_indexUploadPool.data() + indexOffsets.at(i);
+    }
 
-        if (Q_UNLIKELY(debug_upload())) qDebug() << "  --- vertex/index buffers unmapped, batch upload completed...";
+    if (batches.size() > 1 && vertexCount >= qsg_concurrent_upload_vertex_threshold) {
+        QAtomicInt next;
+        const int helpers = qMin(m_uploadThreadPool->maxThreadCount(), batches.size() - 1);
+        for (int i = 0; i < helpers; ++i)
+            m_uploadThreadPool->start(new BatchUploader(this, batches, &next, separateIndexBuffer));
+        BatchUploader(this, batches, &next, separateIndexBuffer).run();
+        m_uploadThreadPool->waitForDone();
+    } else {
+        for (Batch *b : qAsConst(batches))
+            fillBatch(b, separateIndexBuffer);
+    }
 
-        b->needsUpload = false;
+    for (Batch *b : qAsConst(batches))
+        finishBatchUpload(b, separateIndexBuffer);
 
-        if (Q_UNLIKELY(debug_render()))
-            b->uploadedThisFrame = true;
+    *vertexUploadSize += vertexPoolSize;
+    *indexUploadSize += indexPoolSize;
+}
+
+void Renderer::uploadBatch(Batch *b)
+{
+    int bufferSize;
+    int ibufferSize;
+    if (!prepareBatchUpload(b, &bufferSize, &ibufferSize))
+        return;
+
+    const bool separateIndexBuffer = m_context->separateIndexBuffer();
+    if (separateIndexBuffer)
+        map(&b->ibo, ibufferSize, true);
+    else
+        bufferSize += ibufferSize;
+    map(&b->vbo, bufferSize);
+
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
+                               << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
+                               << " vbo:" << b->vbo.id << ":" << b->vbo.size;
+
+    fillBatch(b, separateIndexBuffer);
+    finishBatchUpload(b, separateIndexBuffer);
 }
 
 /*!
@@ -2528,11 +2704,15 @@ void Renderer::renderBatches()
     if (Q_LIKELY(renderOpaque)) {
         for (int i=0; i<m_opaqueBatches.size(); ++i) {
             Batch *b = m_opaqueBatches.at(i);
-            if (b->merged)
+            if (b->merged) {
                 renderMergedBatch(b);
-            else
+                ++m_statistics.mergedBatchCount;
+            } else {
                 renderUnmergedBatch(b);
+                ++m_statistics.unmergedBatchCount;
+            }
         }
+        m_statistics.batchCount += m_opaqueBatches.size();
     }
 
     glEnable(GL_BLEND);
@@ -2543,13 +2723,17 @@ void Renderer::renderBatches()
     if (Q_LIKELY(renderAlpha)) {
         for (int i=0; i<m_alphaBatches.size(); ++i) {
             Batch *b = m_alphaBatches.at(i);
-            if (b->merged)
+            if (b->merged) {
                 renderMergedBatch(b);
-            else if (b->isRenderNode)
+                ++m_statistics.mergedBatchCount;
+            } else if (b->isRenderNode) {
                 renderRenderNode(b);
-            else
+            } else {
                 renderUnmergedBatch(b);
+                ++m_statistics.unmergedBatchCount;
+            }
         }
+        m_statistics.batchCount += m_alphaBatches.size();
     }
 
     if (m_currentShader)
@@ -2560,21 +2744,24 @@ void Renderer::renderBatches()
     glDepthMask(true);
 }
 
+static void qsg_removeRemovedElements(QDataBuffer<Element *> &renderList)
+{
+    if (!renderList.size())
+        return;
+    Element **first = renderList.data();
+    Element **last = std::remove_if(first, first + renderList.size(),
+                                    [](Element *e) { return !e || e->removed; });
+    renderList.resize(int(last - first));
+}
+
 void Renderer::deleteRemovedElements()
 {
     if (!m_elementsToDelete.size())
         return;
 
-    for (int i=0; i<m_opaqueRenderList.size(); ++i) {
-        Element **e = m_opaqueRenderList.data() + i;
-        if (*e && (*e)->removed)
-            *e = nullptr;
-    }
-    for (int i=0; i<m_alphaRenderList.size(); ++i) {
-        Element **e = m_alphaRenderList.data() + i;
-        if (*e && (*e)->removed)
-            *e = nullptr;
-    }
+    // Removing subtrees does not rebuild the render lists, so keep them compact
+    qsg_removeRemovedElements(m_opaqueRenderList);
+    qsg_removeRemovedElements(m_alphaRenderList);
 
     for (int i=0; i<m_elementsToDelete.size(); ++i) {
         Element *e = m_elementsToDelete.at(i);
@@ -2627,10 +2814,19 @@ void Renderer::render()
 
     if (m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)) {
         bool complete = (m_rebuild & BuildRenderLists) != 0;
-        if (complete)
-            buildRenderListsFromScratch();
-        else
+        if (!complete) {
             buildRenderListsForTaggedRoots();
+            if (Q_UNLIKELY(m_partialRebuildOverflow)) {
+                if (Q_UNLIKELY(debug_build())) qDebug("Partial rebuild ran out of render orders");
+                complete = true;
+            }
+        }
+        if (complete) {
+            buildRenderListsFromScratch();
+            ++m_fullRebuildCount;
+        } else {
+            ++m_partialRebuildCount;
+        }
         m_rebuild |= BuildBatches;
 
         if (Q_UNLIKELY(debug_build())) {
@@ -2708,24 +2904,31 @@ void Renderer::render()
     int largestVBO = 0;
     int largestIBO = 0;
 
-    if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
-    for (int i=0; i<m_opaqueBatches.size(); ++i) {
-        Batch *b = m_opaqueBatches.at(i);
-        largestVBO = qMax(b->vbo.size, largestVBO);
-        largestIBO = qMax(b->ibo.size, largestIBO);
-        uploadBatch(b);
-    }
-    if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
+    if (m_uploadThreadPool && !debug_upload() && m_visualizeMode == VisualizeNothing
+            && !m_context->hasBrokenIndexBufferObjects()) {
+        // Opaque and alpha batches are prepared together
+        uploadBatchesConcurrently(&largestVBO, &largestIBO);
+        if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
+    } else {
+        if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
+        for (int i=0; i<m_opaqueBatches.size(); ++i) {
+            Batch *b = m_opaqueBatches.at(i);
+            largestVBO = qMax(b->vbo.size, largestVBO);
+            largestIBO = qMax(b->ibo.size, largestIBO);
+            uploadBatch(b);
+        }
+        if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
 
 
-    if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
-    for (int i=0; i<m_alphaBatches.size(); ++i) {
-        Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
-        largestVBO = qMax(b->vbo.size, largestVBO);
-        largestIBO = qMax(b->ibo.size, largestIBO);
+        if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
+        for (int i=0; i<m_alphaBatches.size(); ++i) {
+            Batch *b = m_alphaBatches.at(i);
+            uploadBatch(b);
+            largestVBO = qMax(b->vbo.size, largestVBO);
+            largestIBO = qMax(b->ibo.size, largestIBO);
+        }
+        if (Q_UNLIKELY(debug_render())) timeUploadAlpha = timer.restart();
     }
-    if (Q_UNLIKELY(debug_render())) timeUploadAlpha = timer.restart();
 
     if (largestVBO * 2 < m_vertexUploadPool.size())
         m_vertexUploadPool.resize(largestVBO * 2);
@@ -2741,6 +2944,8 @@ void Renderer::render()
                (int) timeSorting,
                (int) timeUploadOpaque, (int) timeUploadAlpha,
                (int) timer.elapsed());
+        qDebug(" -> render list rebuilds (full/partial): %d/%d",
+               m_fullRebuildCount, m_partialRebuildCount);
     }
 
     m_rebuild = 0;
@@ -66,6 +66,7 @@
 QT_BEGIN_NAMESPACE
 
 class QOpenGLVertexArrayObject;
+class QThreadPool;
 
 namespace QSGBatchRenderer
 {
@@ -619,6 +620,9 @@ public:
         VisualizeOverdraw
     };
 
+    int fullRebuildCount() const { return m_fullRebuildCount; }
+    int partialRebuildCount() const { return m_partialRebuildCount; }
+
 protected:
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
     void render() override;
@@ -641,6 +645,7 @@ private:
     };
 
     friend class Updater;
+    friend class BatchUploader;
 
     void map(Buffer *buffer, int size, bool isIndexBuf = false);
     void unmap(Buffer *buffer, bool isIndexBuf = false);
@@ -657,7 +662,11 @@ private:
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
 
+    bool prepareBatchUpload(Batch *b, int *vertexBufferSize, int *indexBufferSize);
+    void fillBatch(Batch *b, bool separateIndexBuffer);
+    void finishBatchUpload(Batch *b, bool separateIndexBuffer);
     void uploadBatch(Batch *b);
+    void uploadBatchesConcurrently(int *vertexUploadSize, int *indexUploadSize);
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount);
 
     void renderBatches();
@@ -700,6 +709,7 @@ private:
     int m_nextRenderOrder;
     bool m_partialRebuild;
     QSGNode *m_partialRebuildRoot;
+    bool m_partialRebuildOverflow;
 
     bool m_useDepthBuffer;
 
@@ -717,6 +727,8 @@ private:
     qreal m_zRange;
     int m_renderOrderRebuildLower;
     int m_renderOrderRebuildUpper;
+    int m_fullRebuildCount;
+    int m_partialRebuildCount;
 
     GLuint m_bufferStrategy;
     int m_batchNodeThreshold;
@@ -737,6 +749,7 @@ private:
 
     QDataBuffer<char> m_vertexUploadPool;
     QDataBuffer<char> m_indexUploadPool;
+    QThreadPool *m_uploadThreadPool;
     // For minimal OpenGL core profile support
     QOpenGLVertexArrayObject *m_vao;
 
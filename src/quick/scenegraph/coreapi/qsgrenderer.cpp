@@ -218,6 +218,7 @@ void QSGRenderer::renderScene(const QSGBindable &bindable)
     qint64 renderTime = 0;
 
     m_bindable = &bindable;
+    m_statistics = QSGRendererStatistics();
     preprocess();
 
     bindable.bind();
@@ -57,6 +57,7 @@
 #include "qsgmaterial.h"
 
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgframestatistics_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -97,6 +98,9 @@ public:
 
     void clearChangedFlag() { m_changed_emitted = false; }
 
+    // Counters of the last frame, filled in by the renderer implementation
+    const QSGRendererStatistics &statistics() const { return m_statistics; }
+
 protected:
     virtual void render() = 0;
 
@@ -115,6 +119,8 @@ protected:
 
     QSGRenderContext *m_context;
 
+    QSGRendererStatistics m_statistics;
+
 private:
     QSGNodeUpdater *m_node_updater;
 
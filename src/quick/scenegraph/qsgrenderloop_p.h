@@ -107,6 +107,9 @@ public:
     static void setInstance(QSGRenderLoop *instance);
 
     virtual bool interleaveIncubation() const { return false; }
+    // Milliseconds the GUI thread can spend incubating after timeToIncubate() without
+    // delaying the next frame of \a window, or -1 when the render loop does not know.
+    virtual int incubationTimeBudget(QQuickWindow *window) const { Q_UNUSED(window); return -1; }
 
     virtual int flags() const { return 0; }
 
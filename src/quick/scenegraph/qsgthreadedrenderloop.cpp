@@ -345,6 +345,10 @@ public:
 
     QElapsedTimer m_timer;
 
+    // Running average of the time spent rendering a frame, in microseconds.
+    // Written by the render thread and read by the GUI thread.
+    QAtomicInt averageRenderTime;
+
     QQuickWindow *window; // Will be 0 when window is not exposed
     QSize windowSize;
 
@@ -642,7 +646,10 @@ void QSGRenderThread::syncAndRender()
         QCoreApplication::postEvent(window, new QEvent(QEvent::Type(QQuickWindowPrivate::FullUpdateRequest)));
     }
     if (current) {
+        QElapsedTimer renderTimer;
+        renderTimer.start();
         d->renderSceneGraph(windowSize);
+        averageRenderTime.store((averageRenderTime.load() * 3 + int(renderTimer.nsecsElapsed() / 1000)) / 4);
         if (profileFrames)
             renderTime = threadTimer.nsecsElapsed();
         Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -807,6 +814,25 @@ bool QSGThreadedRenderLoop::interleaveIncubation() const
     return m_animation_driver->isRunning() && anyoneShowing();
 }
 
+/*
+    The GUI thread is idle from the end of polishAndSync() until the render
+    thread asks for the next sync. That happens one vsync interval after the
+    current frame started, or later when polish, sync and rendering together
+    take longer than that. Hand what is left until then to the incubator, but
+    never more than one interval.
+ */
+int QSGThreadedRenderLoop::incubationTimeBudget(QQuickWindow *window) const
+{
+    const Window *w = windowFor(m_windows, window);
+    if (!w || !w->frameTimer.isValid())
+        return -1;
+    const int interval = qsgrl_animation_interval();
+    const qint64 renderTime = qint64(w->thread->averageRenderTime.load()) * 1000;
+    const qint64 frameTime = qMax(qint64(interval) * 1000000, w->averageSyncTime + renderTime);
+    const qint64 remaining = frameTime - w->frameTimer.nsecsElapsed();
+    return qBound(1, int(remaining / 1000000), interval);
+}
+
 void QSGThreadedRenderLoop::animationStarted()
 {
     qCDebug(QSG_LOG_RENDERLOOP, "- animationStarted()");
@@ -937,6 +963,7 @@ void QSGThreadedRenderLoop::handleExposure(QQuickWindow *window)
         win.thread = new QSGRenderThread(this, QQuickWindowPrivate::get(window)->context);
         win.updateDuringSync = false;
         win.forceRenderPass = true; // also covered by polishAndSync(inExpose=true), but doesn't hurt
+        win.averageSyncTime = 0;
         m_windows << win;
         w = &m_windows.last();
     }
@@ -1182,6 +1209,7 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
     if (profileFrames)
         timer.start();
+    w->frameTimer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishAndSync);
 
     QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
@@ -1217,6 +1245,9 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphPolishAndSync,
                               QQuickProfiler::SceneGraphPolishAndSyncSync);
 
+    // Smooth over a few frames so that a single slow sync does not starve incubation.
+    w->averageSyncTime = (w->averageSyncTime * 3 + w->frameTimer.nsecsElapsed()) / 4;
+
     if (m_animation_timer == 0 && m_animation_driver->isRunning()) {
         qCDebug(QSG_LOG_RENDERLOOP, "- advancing animations");
         m_animation_driver->advance();
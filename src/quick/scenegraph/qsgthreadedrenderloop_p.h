@@ -52,6 +52,7 @@
 //
 
 #include <QtCore/QThread>
+#include <QtCore/QElapsedTimer>
 #include <QtGui/QOpenGLContext>
 #include <private/qsgcontext_p.h>
 
@@ -91,6 +92,7 @@ public:
     void postJob(QQuickWindow *window, QRunnable *job) override;
 
     bool interleaveIncubation() const override;
+    int incubationTimeBudget(QQuickWindow *window) const override;
 
 public Q_SLOTS:
     void animationStarted();
@@ -103,6 +105,10 @@ private:
         QSurfaceFormat actualWindowFormat;
         uint updateDuringSync : 1;
         uint forceRenderPass : 1;
+        // Start of the current frame on the GUI thread and a running average
+        // of how long polish and sync take, used to size the incubation budget.
+        QElapsedTimer frameTimer;
+        qint64 averageSyncTime;
     };
 
     friend class QSGRenderThread;
@@ -39,6 +39,7 @@ HEADERS += \
     $$PWD/util/qsgareaallocator_p.h \
     $$PWD/util/qsgengine.h \
     $$PWD/util/qsgengine_p.h \
+    $$PWD/util/qsgframestatistics_p.h \
     $$PWD/util/qsgsimplerectnode.h \
     $$PWD/util/qsgsimpletexturenode.h \
     $$PWD/util/qsgtexture.h \
@@ -56,6 +57,7 @@ HEADERS += \
 SOURCES += \
     $$PWD/util/qsgareaallocator.cpp \
     $$PWD/util/qsgengine.cpp \
+    $$PWD/util/qsgframestatistics.cpp \
     $$PWD/util/qsgsimplerectnode.cpp \
     $$PWD/util/qsgsimpletexturenode.cpp \
     $$PWD/util/qsgtexture.cpp \
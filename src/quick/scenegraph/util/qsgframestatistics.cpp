@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsgframestatistics_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QSGFrameStatisticsBuffer
+    \internal
+
+    Keeps the statistics of the last frames of a window in a ring buffer.
+    Frames are recorded on the render thread and can be read from any thread,
+    which only takes a lock. Recording is off until a capacity is set.
+ */
+
+QSGFrameStatisticsBuffer::QSGFrameStatisticsBuffer()
+    : m_enabled(0)
+    , m_next(0)
+    , m_count(0)
+    , m_frameNumber(0)
+{
+}
+
+int QSGFrameStatisticsBuffer::capacity() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_frames.size();
+}
+
+/*!
+    Sets the number of frames that are kept to \a capacity. The recorded
+    frames are dropped. A capacity of 0 turns recording off.
+ */
+void QSGFrameStatisticsBuffer::setCapacity(int capacity)
+{
+    QMutexLocker locker(&m_mutex);
+    m_frames.fill(QSGFrameStatistics(), qMax(0, capacity));
+    m_next = 0;
+    m_count = 0;
+    m_enabled.store(m_frames.isEmpty() ? 0 : 1);
+}
+
+/*!
+    Adds \a frame as the latest frame, replacing the oldest one when the
+    buffer is full. The frame is numbered by the buffer.
+ */
+void QSGFrameStatisticsBuffer::record(const QSGFrameStatistics &frame)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_frames.isEmpty())
+        return;
+    QSGFrameStatistics &slot = m_frames[m_next];
+    slot = frame;
+    slot.frame = ++m_frameNumber;
+    m_next = (m_next + 1) % m_frames.size();
+    m_count = qMin(m_count + 1, m_frames.size());
+}
+
+/*!
+    Returns the recorded frames, oldest first.
+ */
+QVector<QSGFrameStatistics> QSGFrameStatisticsBuffer::frames() const
+{
+    QMutexLocker locker(&m_mutex);
+    QVector<QSGFrameStatistics> result;
+    result.reserve(m_count);
+    const int first = m_count < m_frames.size() ? 0 : m_next;
+    for (int i = 0; i < m_count; ++i)
+        result.append(m_frames.at((first + i) % m_frames.size()));
+    return result;
+}
+
+void QSGFrameStatisticsBuffer::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_next = 0;
+    m_count = 0;
+}
+
+QT_END_NAMESPACE
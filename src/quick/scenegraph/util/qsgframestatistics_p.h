@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSGFRAMESTATISTICS_P_H
+#define QSGFRAMESTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+struct QSGRendererStatistics
+{
+    int batchCount = 0;
+    int mergedBatchCount = 0;
+    int unmergedBatchCount = 0;
+    qint64 uploadedBytes = 0;
+};
+
+// Times are in nanoseconds
+struct QSGFrameStatistics
+{
+    quint64 frame = 0;
+    qint64 polishTime = 0;
+    qint64 syncTime = 0;
+    qint64 renderTime = 0;
+    QSGRendererStatistics renderer;
+};
+
+Q_DECLARE_TYPEINFO(QSGRendererStatistics, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QSGFrameStatistics, Q_PRIMITIVE_TYPE);
+
+class Q_QUICK_PRIVATE_EXPORT QSGFrameStatisticsBuffer
+{
+public:
+    QSGFrameStatisticsBuffer();
+
+    int capacity() const;
+    void setCapacity(int capacity);
+    bool isEnabled() const { return m_enabled.load(); }
+
+    void record(const QSGFrameStatistics &frame);
+    QVector<QSGFrameStatistics> frames() const;
+    void clear();
+
+private:
+    mutable QMutex m_mutex;
+    QAtomicInt m_enabled;
+    QVector<QSGFrameStatistics> m_frames;
+    int m_next;
+    int m_count;
+    quint64 m_frameNumber;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSGFRAMESTATISTICS_P_H
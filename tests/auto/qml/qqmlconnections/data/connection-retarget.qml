@@ -0,0 +1,15 @@
+import QtQuick 2.0
+
+Item {
+    property int changes: 0
+
+    Item { id: first; objectName: "first" }
+    Item { id: second; objectName: "second" }
+
+    Connections {
+        objectName: "connections"
+        target: first
+        onWidthChanged: ++changes
+        onHeightChanged: ++changes
+    }
+}
@@ -55,6 +55,7 @@ private slots:
     void disabledAtStart();
     void clearImplicitTarget();
     void onWithoutASignal();
+    void retarget();
 
 private:
     QQmlEngine engine;
@@ -407,6 +408,41 @@ void tst_qqmlconnections::onWithoutASignal()
     QVERIFY(item == nullptr); // should parse error, and not give us an item (or crash).
 }
 
+// Retargeting destroys and recreates the signal handlers each time
+void tst_qqmlconnections::retarget()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("connection-retarget.qml"));
+    QScopedPointer<QQuickItem> item(qobject_cast<QQuickItem*>(c.create()));
+    QVERIFY(item != nullptr);
+
+    QQmlConnections *connections = item->findChild<QQmlConnections*>("connections");
+    QVERIFY(connections);
+    QQuickItem *first = item->findChild<QQuickItem*>("first");
+    QVERIFY(first);
+    QQuickItem *second = item->findChild<QQuickItem*>("second");
+    QVERIFY(second);
+
+    int expected = 0;
+    for (int i = 1; i <= 10; ++i) {
+        QQuickItem *target = (i % 2) ? second : first;
+        QQuickItem *other = (i % 2) ? first : second;
+        connections->setTarget(target);
+        QCOMPARE(connections->target(), target);
+
+        target->setWidth(i);
+        target->setHeight(i);
+        expected += 2;
+        other->setWidth(100 + i);
+        QCOMPARE(item->property("changes").toInt(), expected);
+
+        // clearing the target in between must not leave stale handlers behind
+        connections->setTarget(nullptr);
+        target->setWidth(200 + i);
+        QCOMPARE(item->property("changes").toInt(), expected);
+    }
+}
+
 QTEST_MAIN(tst_qqmlconnections)
 
 #include "tst_qqmlconnections.moc"
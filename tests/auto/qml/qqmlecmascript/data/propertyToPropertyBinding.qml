@@ -0,0 +1,23 @@
+import QtQml 2.0
+
+QtObject {
+    id: root
+
+    property QtObject sourceObject: QtObject {
+        id: source
+        property int intValue: 10
+        property real realValue: 1.5
+        property string stringValue: "foo"
+        property bool boolValue: true
+    }
+
+    property int intCopy: source.intValue
+    property real realCopy: source.realValue
+    property string stringCopy: source.stringValue
+    property bool boolCopy: source.boolValue
+
+    // Different types, goes through the JavaScript engine
+    property real convertedCopy: source.intValue
+
+    function assignIntCopy(value) { intCopy = value }
+}
@@ -49,6 +49,8 @@
 #include <private/qv4object_p.h>
 #include <private/qqmlcomponentattached_p.h>
 #include <private/qv4objectiterator_p.h>
+#include <private/qqmlbinding_p.h>
+#include <private/qqmlproperty_p.h>
 
 #ifdef Q_CC_MSVC
 #define NO_INLINE __declspec(noinline)
@@ -353,6 +355,7 @@ private slots:
     void anotherNaN();
     void callPropertyOnUndefined();
     void jumpStrictNotEqualUndefined();
+    void propertyToPropertyBinding();
 
 private:
 //    static void propertyVarWeakRefCallback(v8::Persistent<v8::Value> object, void* parameter);
@@ -8513,6 +8516,69 @@ void tst_qqmlecmascript::jumpStrictNotEqualUndefined()
     QCOMPARE(v.toInt(), 2);
 }
 
+void tst_qqmlecmascript::propertyToPropertyBinding()
+{
+    QQmlComponent component(&engine, testFileUrl("propertyToPropertyBinding.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+
+    QObject *source = root->property("sourceObject").value<QObject *>();
+    QVERIFY(source);
+
+    // Same typed id.property bindings don't run a JavaScript function
+    for (const char *name : {"intCopy", "realCopy", "stringCopy", "boolCopy"}) {
+        QQmlBinding *binding = static_cast<QQmlBinding *>(
+                    QQmlPropertyPrivate::binding(QQmlProperty(root.data(), QLatin1String(name))));
+        QVERIFY2(binding, name);
+        QVERIFY2(!binding->function(), name);
+    }
+    QQmlBinding *convertedBinding = static_cast<QQmlBinding *>(
+                QQmlPropertyPrivate::binding(QQmlProperty(root.data(), "convertedCopy")));
+    QVERIFY(convertedBinding);
+    QVERIFY(convertedBinding->function());
+
+    QCOMPARE(root->property("intCopy").toInt(), 10);
+    QCOMPARE(root->property("realCopy").toReal(), 1.5);
+    QCOMPARE(root->property("stringCopy").toString(), QStringLiteral("foo"));
+    QCOMPARE(root->property("boolCopy").toBool(), true);
+    QCOMPARE(root->property("convertedCopy").toReal(), 10.0);
+
+    source->setProperty("intValue", 42);
+    source->setProperty("realValue", 2.5);
+    source->setProperty("stringValue", QStringLiteral("bar"));
+    source->setProperty("boolValue", false);
+
+    QCOMPARE(root->property("intCopy").toInt(), 42);
+    QCOMPARE(root->property("realCopy").toReal(), 2.5);
+    QCOMPARE(root->property("stringCopy").toString(), QStringLiteral("bar"));
+    QCOMPARE(root->property("boolCopy").toBool(), false);
+    QCOMPARE(root->property("convertedCopy").toReal(), 42.0);
+
+    // Assigning a value in JavaScript removes the binding, as for any other binding
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "assignIntCopy", Q_ARG(QVariant, 1)));
+    QVERIFY(!QQmlPropertyPrivate::binding(QQmlProperty(root.data(), "intCopy")));
+    source->setProperty("intValue", 43);
+    QCOMPARE(root->property("intCopy").toInt(), 1);
+
+    QQmlPropertyPrivate::removeBinding(QQmlProperty(root.data(), "stringCopy"));
+    source->setProperty("stringValue", QStringLiteral("baz"));
+    QCOMPARE(root->property("stringCopy").toString(), QStringLiteral("bar"));
+
+    // Deleting the source object reports the same error as the JavaScript binding does
+    // and keeps the last value
+    const QString url = component.url().toString();
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QRegularExpression::escape(url)
+            + QLatin1String(":15:.*TypeError: Cannot read property 'realValue' of null")));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QRegularExpression::escape(url)
+            + QLatin1String(":17:.*TypeError: Cannot read property 'boolValue' of null")));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QRegularExpression::escape(url)
+            + QLatin1String(":20:.*TypeError: Cannot read property 'intValue' of null")));
+    delete source;
+    QCOMPARE(root->property("realCopy").toReal(), 2.5);
+    QCOMPARE(root->property("boolCopy").toBool(), false);
+    QCOMPARE(root->property("convertedCopy").toReal(), 43.0);
+}
+
 QTEST_MAIN(tst_qqmlecmascript)
 
 #include "tst_qqmlecmascript.moc"
@@ -0,0 +1,12 @@
+import QtQml 2.0
+
+QtObject {
+    property url relative: "images/../icons/logo%2Fsmall.png"
+    property url sameRelative: "images/../icons/logo%2Fsmall.png"
+    property url absolute: "http://www.qt-project.org/logo.png"
+    property url empty: ""
+
+    property QtObject child: QtObject {
+        property url relative: "images/../icons/logo%2Fsmall.png"
+    }
+}
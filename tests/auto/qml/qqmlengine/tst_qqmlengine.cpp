@@ -43,6 +43,7 @@
 #include <QQmlIncubationController>
 #include <QTemporaryDir>
 #include <private/qqmlengine_p.h>
+#include <private/qqmlcomponent_p.h>
 #include <QQmlAbstractUrlInterceptor>
 
 class tst_qqmlengine : public QQmlDataTest
@@ -73,6 +74,7 @@ private slots:
     void qtqmlModule();
     void urlInterceptor_data();
     void urlInterceptor();
+    void urlLiterals();
     void qmlContextProperties();
     void testGCCorruption();
     void testGroupedPropertyRevisions();
@@ -852,6 +854,70 @@ void tst_qqmlengine::urlInterceptor()
     QCOMPARE(o->property("absoluteUrl").toString(), expectedAbsoluteUrl);
 }
 
+class UrlStringInterceptor : public QQmlAbstractUrlInterceptor
+{
+public:
+    QUrl intercept(const QUrl &url, QQmlAbstractUrlInterceptor::DataType type) override
+    {
+        if (type != QQmlAbstractUrlInterceptor::UrlString || url.isEmpty())
+            return url;
+        intercepted.append(url);
+        QUrl result = url;
+        result.setQuery(QStringLiteral("intercepted"));
+        return result;
+    }
+
+    QList<QUrl> intercepted;
+};
+
+void tst_qqmlengine::urlLiterals()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("urlLiterals.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QVERIFY(!QQmlComponentPrivate::get(&component)->compilationUnit->resolvedUrlLiterals.isEmpty());
+
+    // The literals resolve as they did when every instance resolved them itself.
+    const QUrl relative = component.url().resolved(QUrl(QStringLiteral("images/../icons/logo/small.png")));
+    const QUrl absolute(QStringLiteral("http://www.qt-project.org/logo.png"));
+    const auto verifyUrls = [&](QObject *object, const QUrl &relativeUrl, const QUrl &absoluteUrl) {
+        QObject *child = object->property("child").value<QObject *>();
+        return child
+                && object->property("relative").toUrl() == relativeUrl
+                && object->property("sameRelative").toUrl() == relativeUrl
+                && child->property("relative").toUrl() == relativeUrl
+                && object->property("absolute").toUrl() == absoluteUrl
+                && object->property("empty").toUrl() == QUrl();
+    };
+    for (int i = 0; i < 3; ++i) {
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY(object);
+        QVERIFY(verifyUrls(object.data(), relative, absolute));
+    }
+
+    // The interceptor still sees the resolved URLs, once per instance.
+    UrlStringInterceptor interceptor;
+    engine.setUrlInterceptor(&interceptor);
+    QUrl interceptedRelative = relative;
+    interceptedRelative.setQuery(QStringLiteral("intercepted"));
+    QUrl interceptedAbsolute = absolute;
+    interceptedAbsolute.setQuery(QStringLiteral("intercepted"));
+    for (int i = 0; i < 3; ++i) {
+        interceptor.intercepted.clear();
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY(object);
+        QVERIFY(verifyUrls(object.data(), interceptedRelative, interceptedAbsolute));
+        QCOMPARE(interceptor.intercepted.count(relative), 3);
+        QCOMPARE(interceptor.intercepted.count(absolute), 1);
+    }
+
+    // Intercepting does not change the literals later instances start from.
+    engine.setUrlInterceptor(nullptr);
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY(object);
+    QVERIFY(verifyUrls(object.data(), relative, absolute));
+}
+
 void tst_qqmlengine::qmlContextProperties()
 {
     QQmlEngine e;
@@ -159,6 +159,7 @@ private slots:
     void compositorDebug();
     void changeDebug();
     void groupDebug();
+    void farLookupsAfterModifications();
 };
 
 void tst_qqmllistcompositor::find_data()
@@ -1720,6 +1721,134 @@ void tst_qqmllistcompositor::groupDebug()
     qDebug() << Selection;
 }
 
+struct ModelItem
+{
+    void *list;
+    int index;
+    uint flags;
+};
+
+// Looks up every item of a group in an order that keeps consecutive lookups far apart, so the
+// range index is used rather than a walk from the previous lookup.
+static bool verifyFarLookups(QQmlListCompositor &compositor, const QVector<ModelItem> &items, C::Group group)
+{
+    QVector<int> defaultIndexes;
+    for (int i = 0; i < items.count(); ++i) {
+        if (items.at(i).flags & (1 << group))
+            defaultIndexes.append(i);
+    }
+
+    const int count = defaultIndexes.count();
+    if (compositor.count(group) != count) {
+        qWarning() << group << "count" << compositor.count(group) << "expected" << count;
+        return false;
+    }
+
+    for (int i = 0, index = 0; i < count; ++i, index = (index + 97) % count) {
+        const ModelItem &item = items.at(defaultIndexes.at(index));
+        C::iterator it = compositor.find(group, index);
+        if (it.list<void>() != item.list
+                || it.modelIndex() != item.index
+                || it.index[C::Default] != defaultIndexes.at(index)
+                || it.index[group] != index) {
+            qWarning() << group << index << "found" << it << "expected" << item.index;
+            return false;
+        }
+    }
+
+    for (int i = 0, index = 0; i <= count; ++i, index = (index + 97) % (count + 1)) {
+        C::insert_iterator it = compositor.findInsertPosition(group, index);
+        if (it.index[group] != index) {
+            qWarning() << group << index << "insert position" << it;
+            return false;
+        }
+    }
+    return true;
+}
+
+void tst_qqmllistcompositor::farLookupsAfterModifications()
+{
+    int listA; void *a = &listA;
+    int listB; void *b = &listB;
+
+    QQmlListCompositor compositor;
+    compositor.setGroupCount(4);
+
+    QVector<ModelItem> items;
+    const int initialCount = 400;
+    compositor.append(a, 0, initialCount, C::DefaultFlag);
+    for (int i = 0; i < initialCount; ++i)
+        items.append(ModelItem { a, i, C::DefaultFlag });
+
+    // Fragment the compositor into one range per item.
+    for (int i = 0; i < initialCount; i += 2) {
+        compositor.setFlags(C::Default, i, 1, VisibleFlag);
+        items[i].flags |= VisibleFlag;
+    }
+
+    QVERIFY(verifyFarLookups(compositor, items, C::Default));
+    QVERIFY(verifyFarLookups(compositor, items, Visible));
+
+    quint32 seed = 1;
+    const auto random = [&seed](int bound) {
+        seed = seed * 1664525 + 1013904223;
+        return int((seed >> 8) % uint(bound));
+    };
+
+    int listBCount = 0;
+    for (int step = 0; step < 200; ++step) {
+        const int from = random(items.count());
+        const int count = 1 + random(qMin(8, items.count() - from));
+
+        switch (random(5)) {
+        case 0:
+            compositor.setFlags(C::Default, from, count, SelectionFlag);
+            for (int i = from; i < from + count; ++i)
+                items[i].flags |= SelectionFlag;
+            break;
+        case 1:
+            compositor.clearFlags(C::Default, from, count, VisibleFlag);
+            for (int i = from; i < from + count; ++i)
+                items[i].flags &= ~VisibleFlag;
+            break;
+        case 2: {
+            const int to = random(items.count() - count + 1);
+            compositor.move(C::Default, from, C::Default, to, count, C::Default);
+            const QVector<ModelItem> moved = items.mid(from, count);
+            items.remove(from, count);
+            for (int i = 0; i < count; ++i)
+                items.insert(to + i, moved.at(i));
+            break;
+        }
+        case 3:
+            compositor.insert(C::Default, from, b, listBCount, count, C::DefaultFlag | VisibleFlag);
+            for (int i = 0; i < count; ++i)
+                items.insert(from + i, ModelItem { b, listBCount + i, C::DefaultFlag | VisibleFlag });
+            listBCount += count;
+            break;
+        case 4: {
+            // Removing list items walks every range and rebuilds the index.
+            const int index = random(initialCount / 4);
+            QVector<C::Remove> removes;
+            compositor.listItemsRemoved(a, index, 1, &removes);
+            for (int i = 0; i < items.count(); ++i) {
+                if (items.at(i).list != a)
+                    continue;
+                if (items.at(i).index == index)
+                    items.remove(i--);
+                else if (items.at(i).index > index)
+                    items[i].index -= 1;
+            }
+            break;
+        }
+        }
+
+        QVERIFY(verifyFarLookups(compositor, items, C::Default));
+        QVERIFY(verifyFarLookups(compositor, items, Visible));
+        QVERIFY(verifyFarLookups(compositor, items, Selection));
+    }
+}
+
 QTEST_MAIN(tst_qqmllistcompositor)
 
 #include "tst_qqmllistcompositor.moc"
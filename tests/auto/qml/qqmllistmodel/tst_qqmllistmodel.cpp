@@ -546,6 +546,15 @@ void tst_qqmllistmodel::dynamic_data()
         QTest::newRow("invalidInsert1") << "{insert(0, 34);}" << 0 << "<Unknown File>: QML ListModel: insert: value is not an object" << dr;
         QTest::newRow("invalidAppend1") << "{append(37);}" << 0 << "<Unknown File>: QML ListModel: append: value is not an object" << dr;
 
+        QTest::newRow("appendColumns1") << "{appendColumns({'foo':[1,2,3],'bar':['a','b']});count}" << 3 << "" << dr;
+        QTest::newRow("appendColumns2") << "{appendColumns({'foo':[1,2,3],'bar':['a','b']});get(2).foo}" << 3 << "" << dr;
+        QTest::newRow("appendColumns3") << "{appendColumns({'foo':[1,2,3],'bar':['a','b']});get(1).bar == 'b'}" << 1 << "" << dr;
+        QTest::newRow("appendColumns4") << "{append({'foo':5});appendColumns({'foo':[6,7]});get(2).foo}" << 7 << "" << dr;
+        QTest::newRow("appendColumns5") << "{appendColumns({'foo':[null,2,3]});get(2).foo}" << 3 << "" << dr;
+        QTest::newRow("appendColumns6") << "{appendColumns({'foo':[true,false]});get(0).foo ? 1 : 0}" << 1 << "" << dr;
+        QTest::newRow("invalidAppendColumns0") << "{appendColumns(37);count}" << 0 << "<Unknown File>: QML ListModel: appendColumns: value is not an object" << dr;
+        QTest::newRow("invalidAppendColumns1") << "{appendColumns({'foo':5});count}" << 0 << "<Unknown File>: QML ListModel: appendColumns: value of role foo is not an array" << dr;
+
         // QObjects
         QTest::newRow("qobject0") << "{append({'a':dummyItem0});}" << 0 << "" << dr;
         QTest::newRow("qobject1") << "{append({'a':dummyItem0});set(0,{'a':dummyItem1});get(0).a == dummyItem1;}" << 1 << "" << dr;
@@ -104,6 +104,8 @@ private slots:
     void worker_remove_list();
     void dynamic_role_data();
     void dynamic_role();
+    void worker_sync_batched();
+    void worker_sync_main_thread_changes();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -842,6 +844,103 @@ void tst_qqmllistmodelworkerscript::dynamic_role()
     qApp->processEvents();
 }
 
+void tst_qqmllistmodelworkerscript::worker_sync_batched()
+{
+    // Consecutive rows changed by the worker are reported to the main
+    // thread model as one range per sync, not one signal per row.
+
+    QQmlListModel model;
+    QQmlEngine eng;
+    QQmlComponent component(&eng, testFileUrl("model.qml"));
+    QQuickItem *item = createWorkerTest(&eng, &component, &model);
+    QVERIFY(item != nullptr);
+
+    QSignalSpy insertedSpy(&model, SIGNAL(rowsInserted(QModelIndex,int,int)));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(QModelIndex,int,int)));
+    QSignalSpy changedSpy(&model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+
+    QVariantList operations;
+    operations << "append([{'a':0},{'a':1},{'a':2},{'a':3},{'a':4},{'a':5}])";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(model.count(), 6);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 5);
+
+    operations.clear();
+    operations << "setProperty(1,'a',10)" << "setProperty(2,'a',20)" << "setProperty(4,'a',40)";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(changedSpy.count(), 2);
+    QCOMPARE(changedSpy.at(0).at(0).value<QModelIndex>().row(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).value<QModelIndex>().row(), 2);
+    QCOMPARE(changedSpy.at(1).at(0).value<QModelIndex>().row(), 4);
+    QCOMPARE(model.data(model.index(2, 0, QModelIndex()), model.roleNames().key("a")).toInt(), 20);
+
+    operations.clear();
+    operations << "remove(1,3)";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(model.count(), 3);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(removedSpy.at(0).at(2).toInt(), 3);
+
+    delete item;
+    qApp->processEvents();
+}
+
+void tst_qqmllistmodelworkerscript::worker_sync_main_thread_changes()
+{
+    // Rows changed on the main thread are still replaced by the worker's copy on
+    // the next sync, whether or not the worker changed them too.
+
+    QQmlListModel model;
+    QQmlEngine eng;
+    QQmlComponent component(&eng, testFileUrl("model.qml"));
+    QQuickItem *item = createWorkerTest(&eng, &component, &model);
+    QVERIFY(item != nullptr);
+
+    QVariantList operations;
+    operations << "append([{'a':0},{'a':1},{'a':2},{'a':3}])";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(model.count(), 4);
+
+    const int role = model.roleNames().key("a");
+    model.setProperty(1, "a", 100);
+    model.setProperty(2, "a", 200);
+    QCOMPARE(model.data(model.index(1, 0, QModelIndex()), role).toInt(), 100);
+    QCOMPARE(model.data(model.index(2, 0, QModelIndex()), role).toInt(), 200);
+
+    QSignalSpy changedSpy(&model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+    operations.clear();
+    operations << "setProperty(1,'a',10)";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(model.data(model.index(0, 0, QModelIndex()), role).toInt(), 0);
+    QCOMPARE(model.data(model.index(1, 0, QModelIndex()), role).toInt(), 10);
+    QCOMPARE(model.data(model.index(2, 0, QModelIndex()), role).toInt(), 2);
+    QCOMPARE(model.data(model.index(3, 0, QModelIndex()), role).toInt(), 3);
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).value<QModelIndex>().row(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).value<QModelIndex>().row(), 2);
+
+    // Once reconciled, the rows are skipped again until either side changes them.
+    changedSpy.clear();
+    operations.clear();
+    operations << "setProperty(3,'a',30)";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).value<QModelIndex>().row(), 3);
+    QCOMPARE(changedSpy.at(0).at(1).value<QModelIndex>().row(), 3);
+
+    delete item;
+    qApp->processEvents();
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
@@ -0,0 +1,20 @@
+import QtQuick 2.12
+
+ListView {
+    id: list
+    objectName: "list"
+    width: 240
+    height: 200
+    creationThrottleVelocity: 1000
+
+    property int createdCount: 0
+
+    model: 1000
+    delegate: Rectangle {
+        objectName: "wrapper"
+        width: list.width
+        height: 20
+        property int modelIndex: index
+        Component.onCompleted: list.createdCount++
+    }
+}
@@ -0,0 +1,13 @@
+import QtQuick 2.0
+
+ListView {
+    width: 240
+    height: 200
+    cacheBuffer: 0
+    model: testModel
+    delegate: Text {
+        objectName: "wrapper"
+        height: 20
+        text: name + " " + number
+    }
+}
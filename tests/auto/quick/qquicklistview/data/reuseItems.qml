@@ -0,0 +1,23 @@
+import QtQuick 2.12
+
+ListView {
+    id: list
+    objectName: "list"
+    width: 240
+    height: 200
+    cacheBuffer: 0
+    reuseItems: true
+
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    model: 100
+    delegate: Rectangle {
+        objectName: "wrapper"
+        width: list.width
+        height: 20
+        property int modelIndex: index
+        ListView.onPooled: list.pooledCount++
+        ListView.onReused: list.reusedCount++
+    }
+}
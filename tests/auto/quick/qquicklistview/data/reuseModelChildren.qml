@@ -0,0 +1,21 @@
+import QtQuick 2.12
+
+ListView {
+    id: list
+    objectName: "list"
+    width: 240
+    height: 200
+    cacheBuffer: 0
+    reuseItems: true
+
+    property int reusedCount: 0
+
+    delegate: Rectangle {
+        objectName: "wrapper"
+        width: list.width
+        height: 20
+        property int modelIndex: index
+        property bool modelChildren: hasModelChildren
+        ListView.onReused: list.reusedCount++
+    }
+}
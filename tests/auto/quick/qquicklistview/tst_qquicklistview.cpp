@@ -266,6 +266,10 @@ private slots:
     void QTBUG_61537_modelChangesAsync();
 
     void addOnCompleted();
+    void reuseItems();
+    void reuseModelChildren();
+    void creationThrottleVelocity();
+    void prefetchWhileScrolling();
 
 private:
     template <class T> void items(const QUrl &source);
@@ -8791,6 +8795,182 @@ void tst_QQuickListView::addOnCompleted()
     }
 }
 
+void tst_QQuickListView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    QVERIFY(listview->reuseItems());
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+
+    QQuickItem *contentItem = listview->contentItem();
+    QPointer<QQuickItem> firstItem = findItem<QQuickItem>(contentItem, "wrapper", 0);
+    QVERIFY(firstItem);
+
+    // The delegate scrolled out at the top is pooled rather than destroyed...
+    listview->setContentY(20);
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    QVERIFY(listview->property("pooledCount").toInt() > 0);
+    QCOMPARE(listview->property("reusedCount").toInt(), 0);
+    QVERIFY(firstItem);
+
+    // ...and handed out again for the next row scrolled in at the bottom.
+    listview->setContentY(40);
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    QVERIFY(listview->property("reusedCount").toInt() > 0);
+    QVERIFY(firstItem);
+    QVERIFY(firstItem->property("modelIndex").toInt() > 0);
+
+    // Disabling reuse destroys anything still pooled.
+    QQmlInstanceModel *model = QQuickItemViewPrivate::get(listview)->model;
+    QVERIFY(model);
+    listview->setReuseItems(false);
+    QCOMPARE(model->poolSize(), 0);
+}
+
+void tst_QQuickListView::reuseModelChildren()
+{
+    // Only the even rows have children.
+    QStandardItemModel model;
+    for (int i = 0; i < 100; ++i) {
+        QStandardItem *item = new QStandardItem(QString::number(i));
+        if (i % 2 == 0)
+            item->appendRow(new QStandardItem(QLatin1String("child")));
+        model.appendRow(item);
+    }
+
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseModelChildren.qml"));
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    listview->setModel(QVariant::fromValue<QObject *>(&model));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+
+    // Scroll by an odd number of rows so that every reused delegate moves
+    // between a row with children and a row without.
+    for (int i = 1; i <= 5; ++i) {
+        listview->setContentY(i * 20);
+        QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    }
+    QVERIFY(listview->property("reusedCount").toInt() > 0);
+
+    const QList<QQuickItem *> items = findItems<QQuickItem>(listview->contentItem(), "wrapper");
+    QVERIFY(!items.isEmpty());
+    for (QQuickItem *item : items) {
+        const int modelIndex = item->property("modelIndex").toInt();
+        QCOMPARE(item->property("modelChildren").toBool(), modelIndex % 2 == 0);
+    }
+}
+
+void tst_QQuickListView::creationThrottleVelocity()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("creationThrottleVelocity.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    QCOMPARE(listview->creationThrottleVelocity(), qreal(1000));
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+
+    QSignalSpy spy(listview, SIGNAL(creationThrottleVelocityChanged()));
+    listview->setCreationThrottleVelocity(-1);
+    QCOMPARE(listview->creationThrottleVelocity(), qreal(0));
+    QCOMPARE(spy.count(), 1);
+    listview->setCreationThrottleVelocity(1000);
+    QCOMPARE(spy.count(), 2);
+
+    QQuickItemViewPrivate *d = QQuickItemViewPrivate::get(listview);
+    QQuickItem *contentItem = listview->contentItem();
+    int createdCount[2];
+    for (int throttled = 0; throttled < 2; ++throttled) {
+        listview->setCreationThrottleVelocity(throttled ? 1000 : 0);
+        listview->positionViewAtBeginning();
+        QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+        listview->setProperty("createdCount", 0);
+
+        // A fast flick incubates the delegates it passes asynchronously when throttled...
+        listview->flick(0, -listview->maximumFlickVelocity());
+        if (throttled)
+            QTRY_VERIFY(d->isThrottlingCreation());
+        else
+            QVERIFY(!d->isThrottlingCreation());
+
+        // ...and the view is completely filled once it has come to rest.
+        QTRY_VERIFY(!listview->isMoving());
+        QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+        QVERIFY(!d->isThrottlingCreation());
+        QTRY_COMPARE(d->requestedIndex, -1);
+
+        const int first = int(listview->contentY()) / 20;
+        QVERIFY(first > 10);
+        for (int i = first; i < first + 10; ++i)
+            QTRY_VERIFY(findItem<QQuickItem>(contentItem, "wrapper", i));
+        createdCount[throttled] = listview->property("createdCount").toInt();
+    }
+
+    // The same flick creates fewer delegates when their creation is throttled.
+    QVERIFY2(createdCount[1] < createdCount[0],
+             (QByteArray::number(createdCount[1]) + " >= " + QByteArray::number(createdCount[0])).constData());
+}
+
+class DataCountingModel : public QaimModel
+{
+public:
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        ++reads[qMakePair(index.row(), role)];
+        return QaimModel::data(index, role);
+    }
+
+    mutable QHash<QPair<int, int>, int> reads;
+};
+
+void tst_QQuickListView::prefetchWhileScrolling()
+{
+    DataCountingModel model;
+    for (int i = 0; i < 1000; ++i)
+        model.addItem("Item" + QString::number(i), QString::number(i));
+
+    QScopedPointer<QQuickView> window(createView());
+    window->rootContext()->setContextProperty("testModel", &model);
+    window->setSource(testFileUrl("prefetch.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+
+    const auto readsOfRow = [&model](int row) {
+        return model.reads.value(qMakePair(row, int(QaimModel::Name)));
+    };
+
+    // As many rows again as are visible are read ahead of the view.
+    QTRY_COMPARE(readsOfRow(15), 1);
+
+    for (int step = 0; step < 60; ++step) {
+        listview->setContentY(listview->contentY() + 7);
+        QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+        const int lastVisible = int(listview->contentY() + listview->height()) / 20;
+        QTRY_VERIFY(readsOfRow(lastVisible + 5) > 0);
+    }
+
+    // Neither the visible rows nor the rows read ahead were read twice.
+    QVERIFY(!model.reads.isEmpty());
+    for (auto it = model.reads.constBegin(); it != model.reads.constEnd(); ++it) {
+        QVERIFY2(it.value() == 1, qPrintable(QString::fromLatin1("row %1, role %2 read %3 times")
+                                             .arg(it.key().first).arg(it.key().second).arg(it.value())));
+    }
+}
+
 QTEST_MAIN(tst_QQuickListView)
 
 #include "tst_qquicklistview.moc"
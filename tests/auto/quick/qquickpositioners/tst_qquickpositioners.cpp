@@ -52,6 +52,7 @@ private slots:
     void test_horizontal_rtl();
     void test_horizontal_spacing();
     void test_horizontal_spacing_rightToLeft();
+    void test_horizontal_resize();
     void test_horizontal_animated();
     void test_horizontal_animated_padding();
     void test_horizontal_animated_rightToLeft();
@@ -61,6 +62,7 @@ private slots:
     void test_vertical();
     void test_vertical_padding();
     void test_vertical_spacing();
+    void test_vertical_resize();
     void test_vertical_animated();
     void test_vertical_animated_padding();
     void test_grid();
@@ -679,6 +681,39 @@ void tst_qquickpositioners::test_horizontal_spacing_rightToLeft()
     QCOMPARE(three->y(), 2.0);
 }
 
+void tst_qquickpositioners::test_horizontal_resize()
+{
+    QScopedPointer<QQuickView> window(createView(testFile("horizontal.qml")));
+
+    QQuickRectangle *one = window->rootObject()->findChild<QQuickRectangle*>("one");
+    QVERIFY(one != nullptr);
+    QQuickRectangle *two = window->rootObject()->findChild<QQuickRectangle*>("two");
+    QVERIFY(two != nullptr);
+    QQuickRectangle *three = window->rootObject()->findChild<QQuickRectangle*>("three");
+    QVERIFY(three != nullptr);
+    QQuickItem *row = window->rootObject()->findChild<QQuickItem*>("row");
+    QVERIFY(row);
+    QCOMPARE(row->width(), 110.0);
+
+    two->setWidth(30);
+    QTRY_COMPARE(row->width(), 120.0);
+    QCOMPARE(one->x(), 0.0);
+    QCOMPARE(two->x(), 50.0);
+    QCOMPARE(three->x(), 80.0);
+
+    one->setHeight(5);
+    QTRY_COMPARE(row->height(), 20.0);
+
+    // in a right-to-left row the items before the resized one move
+    window->rootObject()->setProperty("testRightToLeft", true);
+    QTRY_COMPARE(three->x(), 0.0);
+    three->setWidth(10);
+    QTRY_COMPARE(row->width(), 90.0);
+    QCOMPARE(one->x(), 40.0);
+    QCOMPARE(two->x(), 10.0);
+    QCOMPARE(three->x(), 0.0);
+}
+
 void tst_qquickpositioners::test_horizontal_animated()
 {
     QScopedPointer<QQuickView> window(createView(testFile("horizontal-animated.qml"), false));
@@ -1441,6 +1476,48 @@ void tst_qquickpositioners::test_vertical()
     QCOMPARE(three->y(), 62.0);
 }
 
+void tst_qquickpositioners::test_vertical_resize()
+{
+    QScopedPointer<QQuickView> window(createView(testFile("vertical.qml")));
+
+    QQuickRectangle *one = window->rootObject()->findChild<QQuickRectangle*>("one");
+    QVERIFY(one != nullptr);
+    QQuickRectangle *two = window->rootObject()->findChild<QQuickRectangle*>("two");
+    QVERIFY(two != nullptr);
+    QQuickRectangle *three = window->rootObject()->findChild<QQuickRectangle*>("three");
+    QVERIFY(three != nullptr);
+    QQuickItem *column = window->rootObject()->findChild<QQuickItem*>("column");
+    QVERIFY(column);
+    column->setProperty("spacing", 2);
+    QTRY_COMPARE(column->height(), 84.0);
+
+    // only the items after the resized one move
+    two->setHeight(30);
+    QTRY_COMPARE(column->height(), 104.0);
+    QCOMPARE(one->y(), 0.0);
+    QCOMPARE(two->y(), 52.0);
+    QCOMPARE(three->y(), 84.0);
+    QCOMPARE(column->width(), 50.0);
+
+    // several items resized before the next polish are positioned together
+    one->setHeight(20);
+    three->setHeight(10);
+    QTRY_COMPARE(column->height(), 64.0);
+    QCOMPARE(two->y(), 22.0);
+    QCOMPARE(three->y(), 54.0);
+
+    // the width follows the widest item when that item shrinks or grows
+    one->setWidth(10);
+    QTRY_COMPARE(column->width(), 40.0);
+    two->setWidth(60);
+    QTRY_COMPARE(column->width(), 60.0);
+
+    // an item with no size is no longer positioned
+    two->setHeight(0);
+    QTRY_COMPARE(column->height(), 32.0);
+    QCOMPARE(three->y(), 22.0);
+}
+
 void tst_qquickpositioners::test_vertical_padding()
 {
     QScopedPointer<QQuickView> window(createView(testFile("vertical.qml")));
@@ -0,0 +1,14 @@
+import QtQuick 2.12
+
+Column {
+    Repeater {
+        objectName: "repeater"
+        model: 20
+        asynchronous: true
+        Rectangle {
+            objectName: "delegate" + index
+            width: 10
+            height: 10
+        }
+    }
+}
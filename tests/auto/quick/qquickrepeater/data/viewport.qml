@@ -0,0 +1,19 @@
+import QtQuick 2.12
+
+Item {
+    width: 100
+    height: 100
+
+    Column {
+        objectName: "column"
+        Repeater {
+            objectName: "repeater"
+            model: 100
+            viewport: Qt.rect(0, 0, 100, 100)
+            Rectangle {
+                width: 100
+                height: 10
+            }
+        }
+    }
+}
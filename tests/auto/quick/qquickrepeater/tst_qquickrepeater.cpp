@@ -76,6 +76,8 @@ private slots:
     void stackingOrder();
     void objectModel();
     void QTBUG54859_asynchronousMove();
+    void asynchronousProperty();
+    void viewport();
 };
 
 class TestObject : public QObject
@@ -1014,6 +1016,61 @@ void tst_QQuickRepeater::QTBUG54859_asynchronousMove()
     QTRY_COMPARE(item->property("finished"), QVariant(true));
 }
 
+void tst_QQuickRepeater::asynchronousProperty()
+{
+    QScopedPointer<QQuickView> window(createView());
+    QQmlIncubationController controller;
+    window->engine()->setIncubationController(&controller);
+    window->setSource(testFileUrl("asynchronousProperty.qml"));
+
+    QQuickRepeater *repeater = findItem<QQuickRepeater>(window->rootObject(), "repeater");
+    QVERIFY(repeater);
+    QCOMPARE(repeater->count(), 20);
+    QVERIFY(!repeater->itemAt(0));
+
+    QSignalSpy addedSpy(repeater, SIGNAL(itemAdded(int,QQuickItem*)));
+    while (addedSpy.count() < 20) {
+        bool b = false;
+        controller.incubateWhile(&b);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        QQuickItem *item = repeater->itemAt(i);
+        QVERIFY(item);
+        QCOMPARE(item->objectName(), QString("delegate%1").arg(i));
+    }
+}
+
+void tst_QQuickRepeater::viewport()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("viewport.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickRepeater *repeater = findItem<QQuickRepeater>(window->rootObject(), "repeater");
+    QVERIFY(repeater);
+    QCOMPARE(repeater->count(), 100);
+
+    // The items up to the first one below the viewport are created.
+    QTRY_VERIFY(repeater->itemAt(11));
+    QCOMPARE(repeater->itemAt(11)->y(), 110.0);
+    QVERIFY(!repeater->itemAt(12));
+    QVERIFY(!repeater->itemAt(99));
+
+    // A distant viewport is reached without creating items past it.
+    repeater->setViewport(QRectF(0, 500, 100, 100));
+    QTRY_VERIFY(repeater->itemAt(61));
+    QCOMPARE(repeater->itemAt(61)->y(), 610.0);
+    QVERIFY(repeater->itemAt(0));
+    QVERIFY(!repeater->itemAt(62));
+    QVERIFY(!repeater->itemAt(99));
+
+    repeater->resetViewport();
+    for (int i = 0; i < 100; ++i)
+        QVERIFY(repeater->itemAt(i));
+}
+
 QTEST_MAIN(tst_QQuickRepeater)
 
 #include "tst_qquickrepeater.moc"
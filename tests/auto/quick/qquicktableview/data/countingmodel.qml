@@ -0,0 +1,15 @@
+import QtQuick 2.12
+
+TableView {
+    width: 400
+    height: 300
+    model: 100
+    delegate: Item {
+        objectName: "tableViewDelegate"
+        implicitWidth: 100
+        implicitHeight: 50
+        property int cellRow: row
+        property int cellColumn: column
+        property int modelIndex: index
+    }
+}
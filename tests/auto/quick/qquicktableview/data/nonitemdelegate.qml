@@ -0,0 +1,8 @@
+import QtQuick 2.12
+
+TableView {
+    width: 400
+    height: 300
+    model: testModel
+    delegate: QtObject {}
+}
@@ -0,0 +1,23 @@
+import QtQuick 2.12
+
+TableView {
+    id: table
+    width: 400
+    height: 300
+    model: testModel
+    reuseItems: true
+
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    delegate: Text {
+        objectName: "tableViewDelegate"
+        implicitWidth: 100
+        implicitHeight: 50
+        text: display
+        property int cellRow: row
+        property int cellColumn: column
+        TableView.onPooled: table.pooledCount++
+        TableView.onReused: table.reusedCount++
+    }
+}
@@ -0,0 +1,324 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQuick/qquickview.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/private/qquicktableview_p.h>
+#include <QtQuick/private/qquicktableview_p_p.h>
+#include "../../shared/util.h"
+#include "../shared/viewtestutil.h"
+
+using namespace QQuickViewTestUtil;
+
+class TestTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    TestTableModel(int rows, int columns, QObject *parent = nullptr)
+        : QAbstractTableModel(parent), m_rows(rows), m_columns(columns) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_rows;
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_columns;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || role != Qt::DisplayRole)
+            return QVariant();
+        return QString::number(index.row()) + QLatin1Char(',') + QString::number(index.column());
+    }
+
+    void setRowCount(int rows)
+    {
+        beginResetModel();
+        m_rows = rows;
+        endResetModel();
+    }
+
+private:
+    int m_rows;
+    int m_columns;
+};
+
+class tst_QQuickTableView : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void tableSize();
+    void contextProperties();
+    void flick();
+    void farJump();
+    void reuseItems();
+    void modelReset();
+    void listModel();
+    void nonItemDelegate();
+    void hugeTable();
+
+private:
+    QQuickView *createTableView(const QString &fileName, TestTableModel *model);
+};
+
+// Returns the delegate items that are laid out, as opposed to pooled or
+// waiting to be laid out, which are culled.
+static QList<QQuickItem *> loadedItems(QQuickTableView *tableView)
+{
+    QList<QQuickItem *> items;
+    const auto children = tableView->contentItem()->childItems();
+    for (QQuickItem *child : children) {
+        if (!QQuickItemPrivate::get(child)->culled)
+            items.append(child);
+    }
+    return items;
+}
+
+static QQuickItem *loadedItem(QQuickTableView *tableView, int row, int column)
+{
+    const auto items = loadedItems(tableView);
+    for (QQuickItem *item : items) {
+        if (item->property("cellRow").toInt() == row && item->property("cellColumn").toInt() == column)
+            return item;
+    }
+    return nullptr;
+}
+
+QQuickView *tst_QQuickTableView::createTableView(const QString &fileName, TestTableModel *model)
+{
+    QQuickView *window = createView();
+    window->rootContext()->setContextProperty(QStringLiteral("testModel"), model);
+    window->setSource(testFileUrl(fileName));
+    window->show();
+    return window;
+}
+
+void tst_QQuickTableView::tableSize()
+{
+    TestTableModel model(100, 100);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    QCOMPARE(tableView->rows(), 100);
+    QCOMPARE(tableView->columns(), 100);
+
+    // Only the cells inside the 400x300 viewport are loaded.
+    QCOMPARE(loadedItems(tableView).count(), 4 * 6);
+    QCOMPARE(tableView->contentWidth(), 100.0 * 100);
+    QCOMPARE(tableView->contentHeight(), 100.0 * 50);
+}
+
+void tst_QQuickTableView::contextProperties()
+{
+    TestTableModel model(10, 10);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    const auto items = loadedItems(tableView);
+    QVERIFY(!items.isEmpty());
+    for (QQuickItem *item : items) {
+        const int row = item->property("cellRow").toInt();
+        const int column = item->property("cellColumn").toInt();
+        QCOMPARE(item->x(), column * 100.0);
+        QCOMPARE(item->y(), row * 50.0);
+        QCOMPARE(item->property("text").toString(), QString("%1,%2").arg(row).arg(column));
+    }
+}
+
+void tst_QQuickTableView::flick()
+{
+    TestTableModel model(100, 100);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    tableView->setContentX(250);
+    tableView->setContentY(120);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    // Columns 0-1 and rows 0-1 are flicked out; columns 2-6 and rows 2-8 are visible.
+    QVERIFY(!loadedItem(tableView, 0, 0));
+    QVERIFY(!loadedItem(tableView, 1, 1));
+    QQuickItem *item = loadedItem(tableView, 2, 2);
+    QVERIFY(item);
+    QCOMPARE(item->position(), QPointF(200, 100));
+    QVERIFY(loadedItem(tableView, 8, 6));
+    QCOMPARE(loadedItems(tableView).count(), 5 * 7);
+}
+
+void tst_QQuickTableView::farJump()
+{
+    TestTableModel model(100, 100);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    // Jumping past the loaded table loads the new cells directly, without
+    // creating the ones in between.
+    tableView->setContentX(5000);
+    tableView->setContentY(2500);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    QQuickItem *item = loadedItem(tableView, 50, 50);
+    QVERIFY(item);
+    QCOMPARE(item->position(), QPointF(5000, 2500));
+    QCOMPARE(loadedItems(tableView).count(), 4 * 6);
+}
+
+void tst_QQuickTableView::reuseItems()
+{
+    TestTableModel model(100, 100);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+    QVERIFY(tableView->reuseItems());
+
+    QPointer<QQuickItem> firstItem = loadedItem(tableView, 0, 0);
+    QVERIFY(firstItem);
+
+    // The column flicked out at the left is pooled and then handed out
+    // again for the column flicked in at the right.
+    tableView->setContentX(150);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+    QCOMPARE(tableView->property("pooledCount").toInt(), 6);
+    QCOMPARE(tableView->property("reusedCount").toInt(), 6);
+    QVERIFY(firstItem);
+    const int row = firstItem->property("cellRow").toInt();
+    QCOMPARE(firstItem->property("cellColumn").toInt(), 4);
+    QCOMPARE(firstItem->property("text").toString(), QString("%1,4").arg(row));
+
+    // Disabling reuse destroys anything still pooled.
+    QQmlTableInstanceModel *tableModel = QQuickTableViewPrivate::get(tableView)->tableModel;
+    QVERIFY(tableModel);
+    tableView->setReuseItems(false);
+    QCOMPARE(tableModel->poolSize(), 0);
+}
+
+void tst_QQuickTableView::modelReset()
+{
+    TestTableModel model(100, 100);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    QSignalSpy rowsSpy(tableView, &QQuickTableView::rowsChanged);
+    model.setRowCount(3);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    QCOMPARE(rowsSpy.count(), 1);
+    QCOMPARE(tableView->rows(), 3);
+    QCOMPARE(loadedItems(tableView).count(), 4 * 3);
+    QCOMPARE(tableView->contentHeight(), 3 * 50.0);
+}
+
+void tst_QQuickTableView::listModel()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("countingmodel.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    // Models without columns give a single column table.
+    QCOMPARE(tableView->rows(), 100);
+    QCOMPARE(tableView->columns(), 1);
+    QCOMPARE(loadedItems(tableView).count(), 6);
+    QQuickItem *item = loadedItem(tableView, 5, 0);
+    QVERIFY(item);
+    QCOMPARE(item->property("modelIndex").toInt(), 5);
+}
+
+void tst_QQuickTableView::nonItemDelegate()
+{
+    TestTableModel model(10, 10);
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*Delegate must be of Item type"));
+    QScopedPointer<QQuickView> window(createTableView("nonitemdelegate.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    // Cells whose delegate can't be used are left empty, rather than
+    // stopping the rest of the table from being loaded.
+    QQuickTableViewPrivate *tableViewPrivate = QQuickTableViewPrivate::get(tableView);
+    QVERIFY(tableViewPrivate->pendingCells.isEmpty());
+    QCOMPARE(tableViewPrivate->loadedTable, QRect(0, 0, 10, 10));
+    QVERIFY(loadedItems(tableView).isEmpty());
+}
+
+void tst_QQuickTableView::hugeTable()
+{
+    // Cells are indexed with an int, so only the columns that can all be
+    // indexed are shown.
+    TestTableModel model(100000, 100000);
+    QScopedPointer<QQuickView> window(createTableView("plaintableview.qml", &model));
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    QVERIFY(tableView);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    const int columns = std::numeric_limits<int>::max() / 100000;
+    QCOMPARE(tableView->rows(), 100000);
+    QCOMPARE(tableView->columns(), columns);
+
+    tableView->setContentX((columns - 4) * 100.0);
+    tableView->setContentY((100000 - 6) * 50.0);
+    QTRY_COMPARE(QQuickItemPrivate::get(tableView)->polishScheduled, false);
+
+    QQuickItem *item = loadedItem(tableView, 100000 - 1, columns - 1);
+    QVERIFY(item);
+    QCOMPARE(item->property("text").toString(), QString("%1,%2").arg(100000 - 1).arg(columns - 1));
+}
+
+QTEST_MAIN(tst_QQuickTableView)
+
+#include "tst_qquicktableview.moc"
@@ -0,0 +1,20 @@
+import QtQuick 2.12
+
+Item {
+    width: 440
+    height: 200
+
+    TextEdit {
+        objectName: "synchronous"
+        width: 200
+        wrapMode: TextEdit.Wrap
+    }
+
+    TextEdit {
+        objectName: "asynchronous"
+        x: 240
+        width: 200
+        wrapMode: TextEdit.Wrap
+        asynchronous: true
+    }
+}
@@ -0,0 +1,17 @@
+import QtQuick 2.0
+
+Flickable {
+    width: 200
+    height: 100
+    clip: true
+    contentWidth: edit.width
+    contentHeight: edit.height
+
+    property alias edit: edit
+
+    TextEdit {
+        id: edit
+        width: 200
+        wrapMode: TextEdit.Wrap
+    }
+}
@@ -0,0 +1,30 @@
+import QtQuick 2.0
+
+Item {
+    width: 200
+    height: 300
+
+    property alias flickable: flickable
+    property alias wrapper: wrapper
+    property alias edit: edit
+
+    Flickable {
+        id: flickable
+        width: 200
+        height: 100
+        contentWidth: wrapper.width
+        contentHeight: wrapper.height
+
+        Item {
+            id: wrapper
+            width: 200
+            height: edit.height
+
+            TextEdit {
+                id: edit
+                width: 200
+                wrapMode: TextEdit.Wrap
+            }
+        }
+    }
+}
@@ -47,6 +47,7 @@
 #include <QClipboard>
 #include <QMimeData>
 #include <private/qquicktextcontrol_p.h>
+#include <private/qquickflickable_p.h>
 #include "../../shared/util.h"
 #include "../../shared/platformquirks.h"
 #include "../../shared/platforminputcontext.h"
@@ -206,6 +207,11 @@ private slots:
     void padding();
     void QTBUG_51115_readOnlyResetsSelection();
 
+    void asynchronous();
+    void viewportNodes();
+    void viewportNodesAfterRemoval();
+    void viewportNodesFollowItems();
+
 private:
     void simulateKeys(QWindow *window, const QList<Key> &keys);
     void simulateKeys(QWindow *window, const QKeySequence &sequence);
@@ -5671,6 +5677,214 @@ void tst_qquicktextedit::QTBUG_51115_readOnlyResetsSelection()
     QCOMPARE(obj->selectedText(), QString());
 }
 
+void tst_qquicktextedit::asynchronous()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("asynchronous.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickTextEdit *synchronousEdit = view.rootObject()->findChild<QQuickTextEdit *>("synchronous");
+    QVERIFY(synchronousEdit);
+    QQuickTextEdit *asynchronousEdit = view.rootObject()->findChild<QQuickTextEdit *>("asynchronous");
+    QVERIFY(asynchronousEdit);
+    QVERIFY(asynchronousEdit->asynchronous());
+
+    QStringList lines;
+    for (int i = 0; i < 2000; ++i)
+        lines.append(QStringLiteral("Line %1 of a long document that wraps in a narrow TextEdit").arg(i));
+    const QString text = lines.join(QLatin1Char('\n'));
+
+    QQuickTextEditPrivate *asynchronousPrivate = QQuickTextEditPrivate::get(asynchronousEdit);
+
+    synchronousEdit->setText(text);
+    asynchronousEdit->setText(text);
+    QVERIFY(synchronousEdit->contentHeight() > view.height());
+    QVERIFY(asynchronousEdit->contentHeight() < synchronousEdit->contentHeight());
+    QVERIFY(asynchronousEdit->lineCount() < synchronousEdit->lineCount());
+    const int laidOutPosition = asynchronousPrivate->laidOutPosition();
+    QVERIFY(laidOutPosition > 0);
+    QVERIFY(laidOutPosition < text.length());
+
+    // Grabbing renders a frame without giving the layout a chance to progress, so the
+    // nodes are only created for the part of the document that is laid out.
+    view.grabWindow();
+    QCOMPARE(asynchronousPrivate->laidOutPosition(), laidOutPosition);
+    QVERIFY(!asynchronousPrivate->textNodeMap.isEmpty());
+    QVERIFY(asynchronousPrivate->textNodeMap.last().startPos() < laidOutPosition);
+    const int initialNodeCount = asynchronousPrivate->textNodeMap.count();
+
+    QTRY_COMPARE(asynchronousEdit->contentHeight(), synchronousEdit->contentHeight());
+    QCOMPARE(asynchronousPrivate->laidOutPosition(), std::numeric_limits<int>::max());
+    QCOMPARE(asynchronousEdit->contentWidth(), synchronousEdit->contentWidth());
+    QCOMPARE(asynchronousEdit->lineCount(), synchronousEdit->lineCount());
+
+    // The rest of the nodes are added once the layout has progressed.
+    QTRY_VERIFY(asynchronousPrivate->textNodeMap.count() > initialNodeCount);
+    QVERIFY(asynchronousPrivate->textNodeMap.last().startPos() > laidOutPosition);
+
+    if ((QGuiApplication::platformName() != QLatin1String("offscreen"))
+        && (QGuiApplication::platformName() != QLatin1String("minimal"))) {
+        const QImage image = view.grabWindow();
+        QCOMPARE(image.copy(240, 0, 200, 200), image.copy(0, 0, 200, 200));
+    }
+
+    synchronousEdit->append(QStringLiteral("One more line"));
+    asynchronousEdit->append(QStringLiteral("One more line"));
+    QTRY_COMPARE(asynchronousEdit->contentHeight(), synchronousEdit->contentHeight());
+    QCOMPARE(asynchronousEdit->lineCount(), synchronousEdit->lineCount());
+
+    asynchronousEdit->setAsynchronous(false);
+    QCOMPARE(asynchronousEdit->contentHeight(), synchronousEdit->contentHeight());
+}
+
+void tst_qquicktextedit::viewportNodes()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("viewport.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickFlickable *flickable = qobject_cast<QQuickFlickable *>(view.rootObject());
+    QVERIFY(flickable);
+    QQuickTextEdit *edit = flickable->property("edit").value<QQuickTextEdit *>();
+    QVERIFY(edit);
+    QQuickTextEditPrivate *editPrivate = QQuickTextEditPrivate::get(edit);
+
+    QStringList lines;
+    for (int i = 0; i < 2000; ++i)
+        lines.append(QStringLiteral("Line %1 of a long log").arg(i));
+    edit->setText(lines.join(QLatin1Char('\n')));
+    const int length = editPrivate->document->characterCount();
+
+    // Only the blocks near the top of the document get nodes
+    QTRY_VERIFY(!editPrivate->textNodeMap.isEmpty());
+    QCOMPARE(editPrivate->textNodeMap.first().startPos(), 0);
+    QVERIFY(editPrivate->textNodeMap.last().startPos() < length / 2);
+
+    // Scrolling to the end replaces them with nodes for the blocks near the end
+    flickable->setContentY(flickable->contentHeight() - flickable->height());
+    QTRY_VERIFY(editPrivate->textNodeMap.first().startPos() > length / 2);
+
+    // Appending to the document keeps the nodes near the viewport
+    edit->append(QStringLiteral("One more line"));
+    flickable->setContentY(flickable->contentHeight() - flickable->height());
+    QTRY_VERIFY(editPrivate->textNodeMap.last().startPos() > length - 300);
+    QCOMPARE(editPrivate->firstUnrenderedPos, std::numeric_limits<int>::max());
+    QVERIFY(editPrivate->textNodeMap.first().startPos() > length / 2);
+}
+
+static bool nodesCoverViewport(QQuickTextEdit *edit)
+{
+    QQuickTextEditPrivate *editPrivate = QQuickTextEditPrivate::get(edit);
+    int start = 0;
+    int end = std::numeric_limits<int>::max();
+    editPrivate->viewportRange(&start, &end);
+    return !editPrivate->textNodeMap.isEmpty()
+            && editPrivate->textNodeMap.first().startPos() <= start
+            && editPrivate->firstUnrenderedPos >= qMin(end, editPrivate->document->characterCount() - 1);
+}
+
+void tst_qquicktextedit::viewportNodesAfterRemoval()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("viewport.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickFlickable *flickable = qobject_cast<QQuickFlickable *>(view.rootObject());
+    QVERIFY(flickable);
+    QQuickTextEdit *edit = flickable->property("edit").value<QQuickTextEdit *>();
+    QVERIFY(edit);
+    QQuickTextEditPrivate *editPrivate = QQuickTextEditPrivate::get(edit);
+
+    QStringList lines;
+    for (int i = 0; i < 2000; ++i)
+        lines.append(QStringLiteral("Line %1 of a long log").arg(i));
+    edit->setText(lines.join(QLatin1Char('\n')));
+
+    flickable->setContentY(flickable->contentHeight() / 2);
+    QTRY_VERIFY(!editPrivate->textNodeMap.isEmpty() && editPrivate->textNodeMap.first().startPos() > 0);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+
+    // Remove a range that starts before the first node and ends inside of it
+    const int firstRendered = editPrivate->textNodeMap.first().startPos();
+    edit->remove(firstRendered - 100, firstRendered + 10);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+
+    // The result looks the same as the same text rendered from scratch
+    QQuickView referenceView;
+    referenceView.setSource(testFileUrl("viewport.qml"));
+    referenceView.setPosition(view.position() + QPoint(view.width() + 10, 0));
+    referenceView.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&referenceView));
+    QQuickFlickable *referenceFlickable = qobject_cast<QQuickFlickable *>(referenceView.rootObject());
+    QVERIFY(referenceFlickable);
+    QQuickTextEdit *referenceEdit = referenceFlickable->property("edit").value<QQuickTextEdit *>();
+    QVERIFY(referenceEdit);
+    referenceEdit->setText(edit->text());
+    referenceFlickable->setContentY(flickable->contentY());
+    QTRY_VERIFY(nodesCoverViewport(referenceEdit));
+
+    if ((QGuiApplication::platformName() == QLatin1String("offscreen"))
+        || (QGuiApplication::platformName() == QLatin1String("minimal")))
+        QSKIP("grabWindow is not functional on offscreen/minimimal platforms");
+
+    QCOMPARE(view.grabWindow(), referenceView.grabWindow());
+}
+
+void tst_qquicktextedit::viewportNodesFollowItems()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("viewportMoves.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickItem *root = view.rootObject();
+    QVERIFY(root);
+    QQuickFlickable *flickable = root->property("flickable").value<QQuickFlickable *>();
+    QVERIFY(flickable);
+    QQuickItem *wrapper = root->property("wrapper").value<QQuickItem *>();
+    QVERIFY(wrapper);
+    QQuickTextEdit *edit = root->property("edit").value<QQuickTextEdit *>();
+    QVERIFY(edit);
+    QQuickTextEditPrivate *editPrivate = QQuickTextEditPrivate::get(edit);
+
+    QStringList lines;
+    for (int i = 0; i < 2000; ++i)
+        lines.append(QStringLiteral("Line %1 of a long log").arg(i));
+    edit->setText(lines.join(QLatin1Char('\n')));
+    QTRY_VERIFY(nodesCoverViewport(edit));
+    const int initialEnd = editPrivate->firstUnrenderedPos;
+    QVERIFY(initialEnd < editPrivate->document->characterCount() / 2);
+
+    // Moving an item between the TextEdit and the Flickable
+    wrapper->setY(-edit->height() / 4);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+    QVERIFY(editPrivate->textNodeMap.first().startPos() > 0);
+
+    // Moving the TextEdit itself
+    edit->setY(-edit->height() / 4);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+
+    // The Flickable does not clip, so the window bounds the visible part
+    view.resize(view.width(), view.height() * 3);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+
+    // Reparenting an item between the TextEdit and the Flickable out of it creates all nodes
+    wrapper->setParentItem(root);
+    QVERIFY(!editPrivate->flickable);
+    QTRY_COMPARE(editPrivate->firstUnrenderedPos, std::numeric_limits<int>::max());
+    QTRY_COMPARE(editPrivate->textNodeMap.first().startPos(), 0);
+
+    // ... and reparenting it back only creates the nodes near the viewport again
+    wrapper->setParentItem(flickable->contentItem());
+    QCOMPARE(editPrivate->flickable.data(), flickable);
+    wrapper->setY(-edit->height() / 2);
+    QTRY_VERIFY(nodesCoverViewport(edit));
+    QTRY_VERIFY(editPrivate->textNodeMap.first().startPos() > 0);
+}
+
 QTEST_MAIN(tst_qquicktextedit)
 
 #include "tst_qquicktextedit.moc"
@@ -0,0 +1,13 @@
+import QtQml 2.0
+import QtQml.Models 2.12
+
+DelegateModel {
+    model: myModel
+    groups: DelegateModelGroup {
+        objectName: "matches"
+        name: "matches"
+        filterRole: "name"
+        filterCaseSensitivity: Qt.CaseInsensitive
+    }
+    delegate: QtObject {}
+}
@@ -45,6 +45,7 @@
 #include <private/qqmlengine_p.h>
 #include <math.h>
 #include <QtGui/qstandarditemmodel.h>
+#include <QtCore/qregularexpression.h>
 
 using namespace QQuickVisualTestUtil;
 using namespace QQuickViewTestUtil;
@@ -431,6 +432,8 @@ private slots:
     void asynchronousMove_data();
     void asynchronousCancel();
     void invalidContext();
+    void filterGroup();
+    void prefetch();
 
 private:
     template <int N> void groups_verify(
@@ -4234,6 +4237,124 @@ void tst_qquickvisualdatamodel::invalidContext()
     QVERIFY(!item);
 }
 
+void tst_qquickvisualdatamodel::filterGroup()
+{
+    SingleRoleModel model(QStringList() << "one" << "two" << "three" << "four" << "five" << "six");
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+    QQmlComponent component(&engine, testFileUrl("filterGroup.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    QQmlDelegateModelGroup *matches = visualModel->findChild<QQmlDelegateModelGroup *>("matches");
+    QVERIFY(matches);
+
+    // An empty filter string matches every item.
+    QCOMPARE(matches->count(), 6);
+
+    QSignalSpy changedSpy(matches, SIGNAL(changed(QQmlV4Handle,QQmlV4Handle)));
+    matches->setFilterString("O");
+    QCOMPARE(matches->count(), 3);
+    QCOMPARE(changedSpy.count(), 1);
+
+    matches->setFilterCaseSensitivity(Qt::CaseSensitive);
+    QCOMPARE(matches->count(), 0);
+
+    matches->setFilterString("e");
+    QCOMPARE(matches->count(), 3);
+
+    // Items inserted into or changed in the model are filtered as well.
+    model.insert(QModelIndex(), 0, QStringList() << "seven" << "eight");
+    QCOMPARE(matches->count(), 5);
+
+    model.set(0, "xyz");
+    QCOMPARE(matches->count(), 4);
+
+    // Only the changed items are evaluated again, wherever they are in the model.
+    model.set(7, "sixteen");
+    QCOMPARE(matches->count(), 5);
+    model.set(6, "nine");
+    QCOMPARE(matches->count(), 5);
+    model.set(3, "two");
+    QCOMPARE(matches->count(), 5);
+    model.set(2, "on");
+    QCOMPARE(matches->count(), 4);
+
+    // Clearing the filter role puts every item back into the group and leaves its
+    // membership alone when the filter string changes afterwards.
+    changedSpy.clear();
+    matches->setFilterRole(QString());
+    QCOMPARE(matches->count(), 8);
+    QCOMPARE(changedSpy.count(), 1);
+
+    matches->setFilterString("zzz");
+    QCOMPARE(matches->count(), 8);
+    model.set(1, "abc");
+    QCOMPARE(matches->count(), 8);
+
+    matches->setFilterRole("name");
+    QCOMPARE(matches->count(), 0);
+
+    // The items group is the source of the filter and can't be filtered itself.
+    QQmlDelegateModelGroup *items = visualModel->property("items").value<QQmlDelegateModelGroup *>();
+    QVERIFY(items);
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*The items group cannot be filtered"));
+    items->setFilterRole("name");
+    QVERIFY(items->filterRole().isEmpty());
+    QCOMPARE(items->count(), 8);
+}
+
+class DataCountingModel : public SingleRoleModel
+{
+public:
+    DataCountingModel(const QStringList &list) : SingleRoleModel(list) {}
+
+    QVariant data(const QModelIndex &index, int role) const
+    {
+        ++dataCalls;
+        return SingleRoleModel::data(index, role);
+    }
+
+    mutable int dataCalls = 0;
+};
+
+void tst_qquickvisualdatamodel::prefetch()
+{
+    DataCountingModel model(QStringList() << "one" << "two" << "three" << "four" << "five" << "six");
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+    QQmlComponent component(&engine);
+    component.setData("import QtQml 2.0\n"
+                      "import QtQml.Models 2.2\n"
+                      "DelegateModel { model: myModel; delegate: QtObject { property string text: name } }",
+                      QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    // The data is read from the event loop rather than when the hint is given.
+    model.dataCalls = 0;
+    visualModel->prefetch(1, 3);
+    QCOMPARE(model.dataCalls, 0);
+    QTRY_COMPARE(model.dataCalls, 3);
+
+    // Delegates created for the prefetched rows don't access the model.
+    QObject *item = visualModel->object(2, QQmlIncubator::Synchronous);
+    QVERIFY(item);
+    QCOMPARE(item->property("text").toString(), QLatin1String("three"));
+    QCOMPARE(model.dataCalls, 3);
+
+    // Changed rows are read from the model again.
+    model.set(2, "THREE");
+    QCOMPARE(item->property("text").toString(), QLatin1String("THREE"));
+    QCOMPARE(model.dataCalls, 4);
+
+    visualModel->release(item);
+}
+
 QTEST_MAIN(tst_qquickvisualdatamodel)
 
 #include "tst_qquickvisualdatamodel.moc"
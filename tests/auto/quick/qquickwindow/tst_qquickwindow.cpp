@@ -45,6 +45,7 @@
 #include <private/qquickwindow_p.h>
 #include <private/qguiapplication_p.h>
 #include <QRunnable>
+#include <QTimer>
 #include <QOpenGLFunctions>
 #include <QSGRendererInterface>
 
@@ -475,6 +476,8 @@ private slots:
     void testChildMouseEventFilter_data();
     void cleanupGrabsOnRelease();
 
+    void frameStatistics();
+
 private:
     QTouchDevice *touchDevice;
     QTouchDevice *touchDeviceWithVelocity;
@@ -3556,6 +3559,41 @@ void tst_qquickwindow::cleanupGrabsOnRelease()
     QCOMPARE(parent->mouseUngrabEventCount, 1);
 }
 
+void tst_qquickwindow::frameStatistics()
+{
+    QQuickWindow window;
+    window.setTitle(QTest::currentTestFunction());
+    window.resize(100, 100);
+    QQuickRectangle *rect = new QQuickRectangle(window.contentItem());
+    rect->setSize(QSizeF(50, 50));
+    rect->setColor(Qt::red);
+
+    QQuickWindowPrivate *wd = QQuickWindowPrivate::get(&window);
+    QVERIFY(!wd->frameStatistics.isEnabled());
+    wd->frameStatistics.setCapacity(3);
+    QVERIFY(wd->frameStatistics.isEnabled());
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    // Keep rendering until the oldest frames have been dropped
+    QTimer updateTimer;
+    connect(&updateTimer, &QTimer::timeout, &window, &QQuickWindow::update);
+    updateTimer.start(16);
+    QTRY_VERIFY(wd->frameStatistics.frames().size() == 3 && wd->frameStatistics.frames().first().frame > 1);
+    updateTimer.stop();
+
+    const QVector<QSGFrameStatistics> frames = wd->frameStatistics.frames();
+    QCOMPARE(frames.size(), 3);
+    for (int i = 1; i < frames.size(); ++i)
+        QCOMPARE(frames.at(i).frame, frames.at(i - 1).frame + 1);
+    QVERIFY(frames.last().renderTime > 0);
+
+    wd->frameStatistics.setCapacity(0);
+    QVERIFY(!wd->frameStatistics.isEnabled());
+    QVERIFY(wd->frameStatistics.frames().isEmpty());
+}
+
 QTEST_MAIN(tst_qquickwindow)
 
 #include "tst_qquickwindow.moc"
@@ -77,6 +77,7 @@ QUICKTESTS += \
     qquickrectangle \
     qquickrepeater \
     qquickshortcut \
+    qquicktableview \
     qquicktext \
     qquicktextdocument \
     qquicktextedit \
@@ -88,7 +89,8 @@ QUICKTESTS += \
     qquickscreen \
     touchmouse \
     scenegraph \
-    sharedimage
+    sharedimage \
+    softwarerenderer
 
 SUBDIRS += $$PUBLICTESTS
 
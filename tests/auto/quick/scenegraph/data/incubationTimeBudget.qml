@@ -0,0 +1,19 @@
+import QtQuick 2.2
+
+Rectangle {
+    width: 100
+    height: 100
+    color: "steelblue"
+    Rectangle {
+        width: 50
+        height: 50
+        anchors.centerIn: parent
+        color: "palegreen"
+        NumberAnimation on rotation {
+            from: 0
+            to: 360
+            duration: 1000
+            loops: Animation.Infinite
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+import QtQuick 2.2
+import SceneGraphTest 1.0
+
+/*
+    The purpose of this test is to verify that elements which are added to
+    a batch root that has run out of spare render orders are rendered
+    correctly when only the enclosing batch root is rebuilt.
+
+    Both items are moved first, which turns them into batch roots. Then more
+    rectangles are added to the inner one than its padding can take, while
+    the outer one still has room for them.
+
+    #samples: 6
+                 PixelPos     R    G    B    Error-tolerance
+    #base:         5   5     1.0  0.0  0.0        0.0
+    #base:         5  25     0.0  0.0  1.0        0.0
+    #final:      105   5     1.0  0.0  0.0        0.0
+    #final:      155  25     0.0  0.0  1.0        0.0
+    #final:      155  35     0.0  1.0  0.0        0.0
+    #final:      195 105     0.0  1.0  0.0        0.0
+*/
+
+RenderTestBase
+{
+    id: root
+
+    Item {
+        id: outer
+        PerPixelRect { width: 20; height: 10; color: "red" }
+
+        Item {
+            id: inner
+            y: 20
+            PerPixelRect { width: 10; height: 10; color: "blue" }
+
+            Repeater {
+                id: repeater
+                model: 0
+                Rectangle {
+                    x: (index % 5) * 10
+                    y: 10 + Math.floor(index / 5) * 10
+                    width: 10
+                    height: 10
+                    color: "#00ff00"
+                }
+            }
+        }
+    }
+
+    SequentialAnimation {
+        id: animation
+        ParallelAnimation {
+            NumberAnimation { target: outer; property: "x"; to: 100; duration: 100 }
+            NumberAnimation { target: inner; property: "x"; to: 50; duration: 100 }
+        }
+        PropertyAction { target: repeater; property: "model"; value: 40 }
+        PauseAnimation { duration: 100 }
+        PropertyAction { target: root; property: "finalStageComplete"; value: true; }
+    }
+
+    onEnterFinalStage: {
+        animation.running = true;
+    }
+}
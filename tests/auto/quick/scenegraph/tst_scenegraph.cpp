@@ -114,6 +114,8 @@ private slots:
     void createTextureFromImage_data();
     void createTextureFromImage();
 
+    void incubationTimeBudget();
+
 private:
     bool m_brokenMipmapSupport;
     QQuickView *createView(const QString &file, QWindow *parent = nullptr, int x = -1, int y = -1, int w = -1, int h = -1);
@@ -386,6 +388,7 @@ void tst_SceneGraph::render_data()
     QTest::addColumn<QString>("file");
     QTest::addColumn<QList<Sample> >("baseStage");
     QTest::addColumn<QList<Sample> >("finalStage");
+    QTest::addColumn<int>("uploadThreads");
 
     QList<QString> files;
     files << "render_DrawSets.qml"
@@ -396,7 +399,8 @@ void tst_SceneGraph::render_data()
           << "render_StackingOrder.qml"
           << "render_ImageFiltering.qml"
           << "render_bug37422.qml"
-          << "render_OpacityThroughBatchRoot.qml";
+          << "render_OpacityThroughBatchRoot.qml"
+          << "render_GrowingBatchRoot.qml";
     if (!m_brokenMipmapSupport)
           files << "render_Mipmap.qml";
 
@@ -434,7 +438,10 @@ void tst_SceneGraph::render_data()
         if (baseStage.size() + finalStage.size() != samples)
             qFatal("render_data: #samples does not add up to number of counted samples, file=%s", qPrintable(fileName));
 
-        QTest::newRow(qPrintable(fileName)) << fileName << baseStage << finalStage;
+        QTest::newRow(qPrintable(fileName)) << fileName << baseStage << finalStage << 0;
+        // Preparing the uploads on several threads must not change the result
+        QTest::newRow(qPrintable(fileName + QLatin1String(" (upload threads)")))
+                << fileName << baseStage << finalStage << 4;
     }
 }
 
@@ -446,6 +453,13 @@ void tst_SceneGraph::render()
     QFETCH(QString, file);
     QFETCH(QList<Sample>, baseStage);
     QFETCH(QList<Sample>, finalStage);
+    QFETCH(int, uploadThreads);
+
+    // Read by the renderer when it is created for the view
+    struct UploadThreadsGuard {
+        UploadThreadsGuard(int threads) { if (threads) qputenv("QSG_RENDERER_UPLOAD_THREADS", QByteArray::number(threads)); }
+        ~UploadThreadsGuard() { qunsetenv("QSG_RENDERER_UPLOAD_THREADS"); }
+    } uploadThreadsGuard(uploadThreads);
 
     QObject suite;
     suite.setObjectName("The Suite");
@@ -569,5 +583,39 @@ bool tst_SceneGraph::isRunningOnOpenGL()
 
 #include "tst_scenegraph.moc"
 
+void tst_SceneGraph::incubationTimeBudget()
+{
+    QSGRenderLoop *loop = QSGRenderLoop::instance();
+
+    // Two animating windows, so that the frames of one cannot be mistaken for
+    // the frames of the other.
+    ScopedList<QQuickView *> views;
+    views << createView("incubationTimeBudget.qml", nullptr, 100, 100, 100, 100);
+    views << createView("incubationTimeBudget.qml", nullptr, 220, 100, 100, 100);
+    for (QQuickView *view : qAsConst(views)) {
+        view->show();
+        QVERIFY(QTest::qWaitForWindowExposed(view));
+    }
+    if (loop->incubationTimeBudget(views.first()) < 0)
+        QSKIP("The render loop does not report an incubation budget");
+
+    QVector<int> budgets[2];
+    QObject receiver;
+    connect(loop, &QSGRenderLoop::timeToIncubate, &receiver, [&]() {
+        for (int i = 0; i < views.size(); ++i)
+            budgets[i].append(loop->incubationTimeBudget(views.at(i)));
+    });
+    QTRY_VERIFY(budgets[0].size() >= 20);
+
+    const qreal refreshRate = QGuiApplication::primaryScreen()->refreshRate();
+    const int interval = refreshRate < 1 ? 16 : int(1000 / refreshRate);
+    for (const QVector<int> &windowBudgets : budgets) {
+        for (int budget : windowBudgets) {
+            QVERIFY2(budget >= 1 && budget <= interval,
+                     qPrintable(QString("budget %1ms, frame interval %2ms").arg(budget).arg(interval)));
+        }
+    }
+}
+
 QTEST_MAIN(tst_SceneGraph)
 
@@ -0,0 +1,51 @@
+import QtQuick 2.12
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    Rectangle {
+        objectName: "moving"
+        x: 10
+        y: 10
+        width: 120
+        height: 150
+        radius: 12
+        gradient: Gradient {
+            GradientStop { position: 0; color: "steelblue" }
+            GradientStop { position: 1; color: "orange" }
+        }
+    }
+
+    Image {
+        x: 60
+        y: 40
+        width: 120
+        height: 120
+        smooth: true
+        opacity: 0.7
+        source: imageSource
+    }
+
+    Text {
+        x: 20
+        y: 70
+        width: 160
+        wrapMode: Text.Wrap
+        font.pixelSize: 16
+        text: "Text is painted on the render thread in between the tiles"
+    }
+
+    Rectangle {
+        x: 100
+        y: 120
+        width: 80
+        height: 60
+        rotation: 15
+        antialiasing: true
+        color: "#8000ff00"
+        border.width: 3
+        border.color: "black"
+    }
+}
@@ -0,0 +1,17 @@
+import QtQuick 2.12
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    Image {
+        objectName: "image"
+        x: 20
+        y: 20
+        width: 150
+        height: 150
+        smooth: true
+        source: imageSource
+    }
+}
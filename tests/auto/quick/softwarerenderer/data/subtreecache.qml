@@ -0,0 +1,34 @@
+import QtQuick 2.12
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    Item {
+        anchors.fill: parent
+
+        Grid {
+            objectName: "grid"
+            columns: 5
+
+            Repeater {
+                model: 25
+                Rectangle {
+                    objectName: "cell" + index
+                    width: 40
+                    height: 40
+                    color: index % 2 ? "steelblue" : "orange"
+                }
+            }
+        }
+    }
+
+    Rectangle {
+        objectName: "mover"
+        y: 90
+        width: 20
+        height: 20
+        color: "black"
+    }
+}
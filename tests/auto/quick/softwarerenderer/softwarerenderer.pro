@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_softwarerenderer
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_softwarerenderer.cpp
+
+include (../../shared/util.pri)
+include (../shared/util.pri)
+
+TESTDATA = data/*
+
+QT += core-private gui-private qml-private quick-private testlib
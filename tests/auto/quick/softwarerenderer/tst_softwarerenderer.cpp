@@ -0,0 +1,306 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/qpainter.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/qquickitemgrabresult.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuick/private/qsgabstractsoftwarerenderer_p.h>
+#include <QtQuick/private/qsgsoftwaresubtreecache_p.h>
+#include "../../shared/util.h"
+#include "../shared/viewtestutil.h"
+
+using namespace QQuickViewTestUtil;
+
+class tst_SoftwareRenderer : public QQmlDataTest
+{
+    Q_OBJECT
+public:
+    tst_SoftwareRenderer();
+
+private slots:
+    void scaledImage();
+    void renderThreads();
+    void subtreeCache();
+};
+
+tst_SoftwareRenderer::tst_SoftwareRenderer()
+{
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+static bool grabbingWorks()
+{
+    return QGuiApplication::platformName() != QLatin1String("offscreen")
+            && QGuiApplication::platformName() != QLatin1String("minimal");
+}
+
+// Compares the colors of two images, allowing for the differences between
+// ways of filtering the same image.
+static bool imagesMatch(const QImage &actual, const QImage &expected, int tolerance)
+{
+    if (actual.size() != expected.size()) {
+        qWarning() << "size" << actual.size() << "expected" << expected.size();
+        return false;
+    }
+    for (int y = 0; y < actual.height(); ++y) {
+        for (int x = 0; x < actual.width(); ++x) {
+            const QRgb a = actual.pixel(x, y);
+            const QRgb e = expected.pixel(x, y);
+            if (qAbs(qRed(a) - qRed(e)) > tolerance || qAbs(qGreen(a) - qGreen(e)) > tolerance
+                    || qAbs(qBlue(a) - qBlue(e)) > tolerance) {
+                qWarning() << "pixel" << x << y << hex << a << "expected" << e;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static QImage checkerboard()
+{
+    QImage image(60, 60, QImage::Format_RGB32);
+    QPainter painter(&image);
+    for (int y = 0; y < 6; ++y) {
+        for (int x = 0; x < 6; ++x)
+            painter.fillRect(x * 10, y * 10, 10, 10, (x + y) % 2 ? Qt::black : Qt::white);
+    }
+    return image;
+}
+
+static bool waitForFrame(QQuickWindow *window)
+{
+    QSignalSpy frameSpy(window, &QQuickWindow::frameSwapped);
+    return frameSpy.wait();
+}
+
+void tst_SoftwareRenderer::scaledImage()
+{
+    if (!grabbingWorks())
+        QSKIP("grabbing is not functional on offscreen/minimal platforms");
+
+    const QImage source = checkerboard();
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString sourceFile = dir.filePath(QStringLiteral("checkerboard.png"));
+    QVERIFY(source.save(sourceFile));
+
+    QScopedPointer<QQuickView> window(createView());
+    window->rootContext()->setContextProperty(QStringLiteral("imageSource"), QUrl::fromLocalFile(sourceFile));
+    window->setSource(testFileUrl("scaledimage.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    if (window->devicePixelRatio() != 1)
+        QSKIP("the reference images are in logical pixels");
+
+    QQuickItem *image = window->rootObject()->findChild<QQuickItem *>("image");
+    QVERIFY(image);
+
+    // Painting the image again at the same size makes the node keep it prescaled.
+    for (int i = 0; i < 2; ++i) {
+        image->setX(image->x() + 1);
+        QVERIFY(waitForFrame(window.data()));
+    }
+
+    const auto imageArea = [image](int inset) {
+        return image->mapRectToScene(image->boundingRect()).toRect().adjusted(inset, inset, -inset, -inset);
+    };
+    QImage content = window->grabWindow();
+    QVERIFY(imagesMatch(content.copy(imageArea(1)),
+                        source.scaled(150, 150, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                                .copy(1, 1, 148, 148),
+                        80));
+
+    // Grabbing the item at half its size scales the painter's window, which the
+    // prescaled image does not account for.
+    QSharedPointer<QQuickItemGrabResult> result = image->grabToImage(QSize(75, 75));
+    QVERIFY(result);
+    QSignalSpy readySpy(result.data(), &QQuickItemGrabResult::ready);
+    QVERIFY(readySpy.wait());
+    QVERIFY(imagesMatch(result->image().copy(1, 1, 73, 73),
+                        source.scaled(75, 75, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                                .copy(1, 1, 73, 73),
+                        80));
+
+    // While the size changes on every frame the image is painted directly, and
+    // prescaled again once it has settled.
+    for (int width = 140; width >= 100; width -= 10) {
+        image->setWidth(width);
+        QVERIFY(waitForFrame(window.data()));
+        content = window->grabWindow();
+        QVERIFY(imagesMatch(content.copy(imageArea(1)),
+                            source.scaled(width, 150, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                                    .copy(1, 1, width - 2, 148),
+                            80));
+    }
+    image->setX(image->x() + 1);
+    QVERIFY(waitForFrame(window.data()));
+    content = window->grabWindow();
+    QVERIFY(imagesMatch(content.copy(imageArea(1)),
+                        source.scaled(100, 150, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                                .copy(1, 1, 98, 148),
+                        80));
+}
+
+void tst_SoftwareRenderer::renderThreads()
+{
+    if (!grabbingWorks())
+        QSKIP("grabbing is not functional on offscreen/minimal platforms");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString sourceFile = dir.filePath(QStringLiteral("checkerboard.png"));
+    QVERIFY(checkerboard().save(sourceFile));
+
+    // The renderer of a window reads QSG_SOFTWARE_RENDER_THREADS when it is created
+    // for the first frame, so only the first window paints in tiles.
+    qputenv("QSG_SOFTWARE_RENDER_THREADS", "4");
+    QScopedPointer<QQuickView> threadedWindow(createView());
+    threadedWindow->rootContext()->setContextProperty(QStringLiteral("imageSource"), QUrl::fromLocalFile(sourceFile));
+    threadedWindow->setSource(testFileUrl("renderthreads.qml"));
+    threadedWindow->show();
+    const bool threadedExposed = QTest::qWaitForWindowExposed(threadedWindow.data());
+    QImage threaded = threadedWindow->grabWindow();
+    qunsetenv("QSG_SOFTWARE_RENDER_THREADS");
+    QVERIFY(threadedExposed);
+
+    QScopedPointer<QQuickView> serialWindow(createView());
+    serialWindow->rootContext()->setContextProperty(QStringLiteral("imageSource"), QUrl::fromLocalFile(sourceFile));
+    serialWindow->setSource(testFileUrl("renderthreads.qml"));
+    serialWindow->setFramePosition(threadedWindow->framePosition() + QPoint(threadedWindow->width() + 50, 0));
+    serialWindow->show();
+    QVERIFY(QTest::qWaitForWindowExposed(serialWindow.data()));
+
+    QImage serial = serialWindow->grabWindow();
+    QVERIFY(!serial.isNull());
+    QVERIFY(imagesMatch(threaded, serial, 2));
+
+    // Moving an item only repaints the area it leaves and enters.
+    for (QQuickView *window : { threadedWindow.data(), serialWindow.data() }) {
+        QQuickItem *moving = window->rootObject()->findChild<QQuickItem *>("moving");
+        QVERIFY(moving);
+        moving->setPosition(QPointF(45, 30));
+        QVERIFY(waitForFrame(window));
+    }
+    threaded = threadedWindow->grabWindow();
+    serial = serialWindow->grabWindow();
+    QVERIFY(imagesMatch(threaded, serial, 2));
+}
+
+// Checks the middle of every cell of the grid in subtreecache.qml that the mover does not cover.
+static bool cellsMatch(const QImage &image, const QRect &mover, const QColor &centerCellColor)
+{
+    for (int i = 0; i < 25; ++i) {
+        const QPoint center((i % 5) * 40 + 20, (i / 5) * 40 + 20);
+        if (mover.contains(center))
+            continue;
+        const QColor expected = i == 12 ? centerCellColor : QColor(i % 2 ? "steelblue" : "orange");
+        if (image.pixelColor(center) != expected) {
+            qWarning() << "cell" << i << image.pixelColor(center) << "expected" << expected;
+            return false;
+        }
+    }
+    return true;
+}
+
+void tst_SoftwareRenderer::subtreeCache()
+{
+    if (!grabbingWorks())
+        QSKIP("grabbing is not functional on offscreen/minimal platforms");
+
+    // The renderer of a window reads QSG_SOFTWARE_SUBTREE_CACHE_SIZE when it is
+    // created for the first frame.
+    qputenv("QSG_SOFTWARE_SUBTREE_CACHE_SIZE", "1024");
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("subtreecache.qml"));
+    window->show();
+    const bool exposed = QTest::qWaitForWindowExposed(window.data());
+    window->grabWindow();
+    qunsetenv("QSG_SOFTWARE_SUBTREE_CACHE_SIZE");
+    QVERIFY(exposed);
+    if (window->devicePixelRatio() != 1)
+        QSKIP("the cells are checked in logical pixels");
+
+    QQuickItem *mover = window->rootObject()->findChild<QQuickItem *>("mover");
+    QVERIFY(mover);
+    QQuickItem *grid = window->rootObject()->findChild<QQuickItem *>("grid");
+    QVERIFY(grid);
+    QQuickItem *centerCell = nullptr;
+    for (QQuickItem *cell : grid->childItems()) {
+        if (cell->objectName() == QLatin1String("cell12"))
+            centerCell = cell;
+    }
+    QVERIFY(centerCell);
+
+    QSGAbstractSoftwareRenderer *renderer
+            = static_cast<QSGAbstractSoftwareRenderer *>(QQuickWindowPrivate::get(window.data())->renderer);
+    QVERIFY(renderer);
+    const QSGSoftwareSubtreeCacheStatistics &statistics = renderer->subtreeCacheStatistics();
+    QCOMPARE(statistics.misses, 0);
+
+    // The mover is outside of the grid's subtree, which is cached once it has been
+    // stable for a few frames. Its image is painted where the mover uncovers the grid.
+    const auto moveMover = [&]() {
+        mover->setX(int(mover->x() + 10) % 180);
+        return waitForFrame(window.data());
+    };
+    for (int i = 0; i < 50 && statistics.misses == 0; ++i)
+        QVERIFY(moveMover());
+    QCOMPARE(statistics.misses, 1);
+    const int hits = statistics.hits;
+    for (int i = 0; i < 5; ++i)
+        QVERIFY(moveMover());
+    QVERIFY(statistics.hits > hits);
+    QCOMPARE(statistics.misses, 1);
+    QVERIFY(cellsMatch(window->grabWindow(), mover->boundingRect().translated(mover->position()).toRect(),
+                       QColor("steelblue")));
+
+    // Changing an item within the subtree paints its nodes directly again, until the
+    // subtree has become stable and is cached with the change.
+    centerCell->setProperty("color", QColor(Qt::red));
+    QVERIFY(waitForFrame(window.data()));
+    QCOMPARE(statistics.misses, 1);
+    QVERIFY(cellsMatch(window->grabWindow(), mover->boundingRect().translated(mover->position()).toRect(),
+                       QColor(Qt::red)));
+
+    for (int i = 0; i < 50 && statistics.misses == 1; ++i)
+        QVERIFY(moveMover());
+    QCOMPARE(statistics.misses, 2);
+    // Move across the center cell, which is then painted from the new image
+    for (int i = 0; i < 18; ++i)
+        QVERIFY(moveMover());
+    QCOMPARE(statistics.misses, 2);
+    QVERIFY(cellsMatch(window->grabWindow(), mover->boundingRect().translated(mover->position()).toRect(),
+                       QColor(Qt::red)));
+}
+
+QTEST_MAIN(tst_SoftwareRenderer)
+
+#include "tst_softwarerenderer.moc"
@@ -1,7 +1,7 @@
 CONFIG += benchmark
 TEMPLATE = app
 TARGET = tst_qqmlchangeset
-QT += qml quick-private testlib
+QT += qml qml-private quick-private testlib
 osx:CONFIG -= app_bundle
 
 SOURCES += tst_qqmlchangeset.cpp
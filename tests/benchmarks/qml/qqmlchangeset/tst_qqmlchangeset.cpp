@@ -31,6 +31,7 @@
 #include <QDebug>
 
 #include <private/qqmlchangeset_p.h>
+#include <private/qqmllistcompositor_p.h>
 
 class tst_qqmlchangeset : public QObject
 {
@@ -38,8 +39,25 @@ class tst_qqmlchangeset : public QObject
 
 private slots:
     void move();
+    void compositorFind_data();
+    void compositorFind();
+    void compositorSetFlags_data();
+    void compositorSetFlags();
 };
 
+static const QQmlListCompositor::Group FilteredGroup = QQmlListCompositor::Group(3);
+
+// Adds every other item of a list to a group, so that the compositor holds
+// as many ranges as there are items.
+static void populateFragmented(QQmlListCompositor *compositor, void *list, int count)
+{
+    compositor->setGroupCount(4);
+    compositor->append(list, 0, count, QQmlListCompositor::DefaultFlag
+            | QQmlListCompositor::AppendFlag | QQmlListCompositor::PrependFlag);
+    for (int i = 0; i < count; i += 2)
+        compositor->setFlags(QQmlListCompositor::Default, i, 1, 1 << FilteredGroup);
+}
+
 void tst_qqmlchangeset::move()
 {
     QBENCHMARK {
@@ -51,5 +69,54 @@ void tst_qqmlchangeset::move()
     }
 }
 
+void tst_qqmlchangeset::compositorFind_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+    QTest::newRow("100000") << 100000;
+}
+
+void tst_qqmlchangeset::compositorFind()
+{
+    QFETCH(int, count);
+
+    int list;
+    QQmlListCompositor compositor;
+    populateFragmented(&compositor, &list, count);
+    const int filteredCount = compositor.count(FilteredGroup);
+
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i) {
+            compositor.find(FilteredGroup, (i * 7919) % filteredCount);
+            compositor.find(QQmlListCompositor::Default, (i * 104729) % count);
+        }
+    }
+}
+
+void tst_qqmlchangeset::compositorSetFlags_data()
+{
+    compositorFind_data();
+}
+
+void tst_qqmlchangeset::compositorSetFlags()
+{
+    QFETCH(int, count);
+
+    int list;
+    QQmlListCompositor compositor;
+    populateFragmented(&compositor, &list, count);
+
+    QBENCHMARK {
+        for (int i = 0; i < 100; ++i) {
+            const int index = 2 * ((i * 7919) % (count / 2));
+            compositor.clearFlags(QQmlListCompositor::Default, index, 1, 1 << FilteredGroup);
+            compositor.setFlags(QQmlListCompositor::Default, index, 1, 1 << FilteredGroup);
+            compositor.find(FilteredGroup, (i * 104729) % compositor.count(FilteredGroup));
+        }
+    }
+}
+
 QTEST_MAIN(tst_qqmlchangeset)
 #include "tst_qqmlchangeset.moc"
@@ -1,7 +1,7 @@
 CONFIG += benchmark
 TEMPLATE = app
 TARGET = tst_qqmlmetaproperty
-QT += qml testlib
+QT += qml qml-private testlib
 macx:CONFIG -= app_bundle
 
 SOURCES += tst_qqmlmetaproperty.cpp
@@ -32,6 +32,11 @@
 #include <QQmlProperty>
 #include <QFile>
 #include <QDebug>
+#include <private/qqmldata_p.h>
+#include <private/qqmlpropertycache_p.h>
+#include <private/qv4engine_p.h>
+#include <private/qv4string_p.h>
+#include <private/qv4scopedvalue_p.h>
 
 class tst_qmlmetaproperty : public QObject
 {
@@ -48,6 +53,8 @@ public slots:
 private slots:
     void lookup_data();
     void lookup();
+    void cacheLookup_data();
+    void cacheLookup();
 
 private:
     QQmlEngine engine;
@@ -93,5 +100,46 @@ void tst_qmlmetaproperty::lookup()
     delete obj;
 }
 
+void tst_qmlmetaproperty::cacheLookup_data()
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<bool>("byIdentifier");
+
+    QTest::newRow("Simple Object, string") << SRCDIR "/data/object.qml" << "x" << false;
+    QTest::newRow("Simple Object, identifier") << SRCDIR "/data/object.qml" << "x" << true;
+    QTest::newRow("Synthesized Object, string") << SRCDIR "/data/synthesized_object.qml" << "blah" << false;
+    QTest::newRow("Synthesized Object, identifier") << SRCDIR "/data/synthesized_object.qml" << "blah" << true;
+    QTest::newRow("Synthesized Object, inherited, string") << SRCDIR "/data/synthesized_object.qml" << "x" << false;
+    QTest::newRow("Synthesized Object, inherited, identifier") << SRCDIR "/data/synthesized_object.qml" << "x" << true;
+}
+
+// Property cache lookups as done by the QObject wrappers of the JS engine.
+void tst_qmlmetaproperty::cacheLookup()
+{
+    QFETCH(QString, file);
+    QFETCH(QString, name);
+    QFETCH(bool, byIdentifier);
+
+    QQmlComponent c(&engine, file);
+    QVERIFY(c.isReady());
+
+    QScopedPointer<QObject> obj(c.create());
+    QVERIFY(obj);
+
+    QQmlData *ddata = QQmlData::get(obj.data());
+    QVERIFY(ddata && ddata->propertyCache);
+    QQmlPropertyCache *cache = ddata->propertyCache;
+
+    QV4::ExecutionEngine *v4 = engine.handle();
+    QV4::Scope scope(v4);
+    QV4::ScopedString key(scope, byIdentifier ? v4->newIdentifier(name) : v4->newString(name));
+    QVERIFY(cache->property(key.getPointer(), obj.data(), nullptr));
+
+    QBENCHMARK {
+        cache->property(key.getPointer(), obj.data(), nullptr);
+    }
+}
+
 QTEST_MAIN(tst_qmlmetaproperty)
 #include "tst_qqmlmetaproperty.moc"
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQuick/private/qquickpositioners_p.h>
+
+class tst_positioners : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void resizeChild_data();
+    void resizeChild();
+};
+
+void tst_positioners::resizeChild_data()
+{
+    QTest::addColumn<QString>("type");
+    QTest::addColumn<int>("count");
+
+    for (const char *type : { "Column", "Row", "Grid", "Flow" }) {
+        for (int count : { 100, 500, 2000 })
+            QTest::newRow(QByteArray(type) + ' ' + QByteArray::number(count)) << QString::fromLatin1(type) << count;
+    }
+}
+
+// Resizes one item near the end of a positioner's children and lays them out again.
+// Columns and rows only move the items after the resized one, so their cost shouldn't
+// depend on the number of children.
+void tst_positioners::resizeChild()
+{
+    QFETCH(QString, type);
+    QFETCH(int, count);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QString::fromLatin1(
+                          "import QtQuick 2.0\n"
+                          "%1 { width: 500; Repeater { model: %2; Rectangle { width: 10; height: 10 } } }")
+                      .arg(type).arg(count).toUtf8(), QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QQuickBasePositioner *positioner = qobject_cast<QQuickBasePositioner *>(object.data());
+    QVERIFY(positioner);
+    positioner->forceLayout();
+
+    const QList<QQuickItem *> children = positioner->childItems();
+    QQuickItem *child = children.at(children.count() - 5);
+    QVERIFY(child->width() > 0);
+
+    const bool horizontal = type == QLatin1String("Row");
+    qreal size = 10;
+    QBENCHMARK {
+        size = size == 10 ? 20 : 10;
+        if (horizontal)
+            child->setWidth(size);
+        else
+            child->setHeight(size);
+        positioner->forceLayout();
+    }
+}
+
+QTEST_MAIN(tst_positioners)
+
+#include "tst_positioners.moc"